@@ -0,0 +1,174 @@
+/**
+ * 内存区域分配器实现文件 / Arena Allocator Implementation
+ *
+ * 块按链表连接，最新的块在表头。分配只做"对齐指针、检查剩余、移动指针"，
+ * 没有逐个释放，所以也没有空闲链表和元数据。
+ *
+ * Blocks form a linked list with the newest at the head. Allocation only aligns the pointer,
+ * checks the space left and bumps the pointer; nothing is freed individually, so there is no
+ * free list and no per-allocation metadata.
+ */
+
+#include "arena.h"
+#include <stdint.h>   // 用于 uintptr_t / For uintptr_t
+#include <stdlib.h>   // 用于 malloc, free / For malloc, free
+#include <string.h>   // 用于 memcpy / For memcpy
+
+// 块头，数据紧跟其后 / Block header; data follows it
+struct arena_block {
+    arena_block_t *next;
+    size_t capacity;
+    _Alignas(ARENA_DEFAULT_ALIGN) char data[];
+};
+
+static inline uintptr_t align_up(uintptr_t p, size_t align) {
+    return (p + (align - 1)) & ~(uintptr_t)(align - 1);
+}
+
+// 分配一个新块 / Allocate a new block
+static arena_block_t* block_new(size_t capacity) {
+    arena_block_t *block = malloc(sizeof(arena_block_t) + capacity);
+    if (block != NULL) {
+        block->next = NULL;
+        block->capacity = capacity;
+    }
+    return block;
+}
+
+// 初始化内存区域 / Initialize an arena
+void arena_init(arena_t *arena, size_t block_size) {
+    if (arena == NULL) {
+        return;
+    }
+    arena->head = NULL;
+    arena->spare = NULL;
+    arena->ptr = NULL;
+    arena->end = NULL;
+    arena->block_size = block_size != 0 ? block_size : ARENA_DEFAULT_BLOCK_SIZE;
+    arena->used = 0;
+    arena->reserved = 0;
+}
+
+// 当前块放不下时 / When the current block has no room
+static void* arena_alloc_slow(arena_t *arena, size_t size, size_t align) {
+    // 最坏情况需要align - 1字节填充 / Worst case needs align - 1 bytes of padding
+    if (size > SIZE_MAX - align) {
+        return NULL;
+    }
+    size_t need = size + align - 1;
+
+    if (need > arena->block_size / 2) {
+        // 大请求单独一块，插在当前块后面，当前块继续使用
+        // Large request: its own block, linked behind the current one, which stays in use
+        arena_block_t *block = block_new(need);
+        if (block == NULL) {
+            return NULL;
+        }
+        if (arena->head != NULL) {
+            block->next = arena->head->next;
+            arena->head->next = block;
+        } else {
+            arena->head = block;
+            arena->ptr = block->data + need;
+            arena->end = block->data + need;
+        }
+        arena->reserved += need;
+        char *p = (char *)align_up((uintptr_t)block->data, align);
+        arena->used += (size_t)(p - block->data) + size;
+        return p;
+    }
+
+    // 优先复用reset留下的块 / Prefer a block kept by a reset
+    arena_block_t *block = arena->spare;
+    if (block != NULL) {
+        arena->spare = block->next;
+    } else {
+        block = block_new(arena->block_size);
+        if (block == NULL) {
+            return NULL;
+        }
+        arena->reserved += block->capacity;
+    }
+    block->next = arena->head;
+    arena->head = block;
+    arena->ptr = block->data;
+    arena->end = block->data + block->capacity;
+
+    char *p = (char *)align_up((uintptr_t)arena->ptr, align);
+    arena->used += (size_t)(p - arena->ptr) + size;
+    arena->ptr = p + size;
+    return p;
+}
+
+// 分配内存 / Allocate memory
+void* arena_alloc(arena_t *arena, size_t size, size_t align) {
+    if (arena == NULL || align == 0 || (align & (align - 1)) != 0) {
+        return NULL;
+    }
+    if (arena->ptr != NULL) {
+        char *p = (char *)align_up((uintptr_t)arena->ptr, align);
+        // 用剩余空间比较，避免指针越界 / Compare against the space left to avoid pointer overflow
+        if (p <= arena->end && size <= (size_t)(arena->end - p)) {
+            arena->used += (size_t)(p - arena->ptr) + size;
+            arena->ptr = p + size;
+            return p;
+        }
+    }
+    return arena_alloc_slow(arena, size, align);
+}
+
+// 复制字符串到内存区域 / Copy a string into the arena
+char* arena_strndup(arena_t *arena, const char *str, size_t len) {
+    if (str == NULL || len == SIZE_MAX) {
+        return NULL;
+    }
+    char *copy = arena_alloc(arena, len + 1, 1);
+    if (copy != NULL) {
+        memcpy(copy, str, len);
+        copy[len] = '\0';
+    }
+    return copy;
+}
+
+// 释放所有分配，保留普通块 / Release every allocation, keeping regular blocks
+void arena_reset(arena_t *arena) {
+    if (arena == NULL) {
+        return;
+    }
+    // 普通块移到备用链表，单独分配的大块直接释放
+    // Regular blocks move to the spare list; dedicated large blocks are freed
+    arena_block_t *block = arena->head;
+    while (block != NULL) {
+        arena_block_t *next = block->next;
+        if (block->capacity == arena->block_size) {
+            block->next = arena->spare;
+            arena->spare = block;
+        } else {
+            arena->reserved -= block->capacity;
+            free(block);
+        }
+        block = next;
+    }
+
+    arena->head = NULL;
+    arena->ptr = NULL;
+    arena->end = NULL;
+    arena->used = 0;
+}
+
+// 释放所有块 / Free every block
+void arena_free(arena_t *arena) {
+    if (arena == NULL) {
+        return;
+    }
+    arena_block_t *lists[2] = { arena->head, arena->spare };
+    for (int i = 0; i < 2; i++) {
+        arena_block_t *block = lists[i];
+        while (block != NULL) {
+            arena_block_t *next = block->next;
+            free(block);
+            block = next;
+        }
+    }
+    arena_init(arena, arena->block_size);
+}
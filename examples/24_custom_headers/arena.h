@@ -0,0 +1,91 @@
+/**
+ * 内存区域分配器头文件 / Arena Allocator Header
+ *
+ * 从大块内存中顺序切出小块（bump分配），一次reset或free释放全部
+ * Carves small pieces off large blocks in order (bump allocation); one reset or free releases them all
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>   // 用于 size_t / For size_t
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 默认块大小 / Default block size
+#define ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+// 默认对齐（适合任何基本类型）/ Default alignment (suitable for any basic type)
+#define ARENA_DEFAULT_ALIGN 16
+
+// 分配一个类型的对象 / Allocate one object of a type
+#define ARENA_NEW(arena, type) ((type *)arena_alloc((arena), sizeof(type), _Alignof(type)))
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+typedef struct arena_block arena_block_t;
+
+// 内存区域 / Arena
+typedef struct {
+    arena_block_t *head;    // 当前块（链表头）/ Current block (list head)
+    arena_block_t *spare;   // reset后留待复用的普通块 / Regular blocks kept for reuse after a reset
+    char *ptr;              // 当前块中下一个空闲字节 / Next free byte in the current block
+    char *end;              // 当前块末尾 / End of the current block
+    size_t block_size;      // 普通块的容量 / Capacity of a regular block
+    size_t used;            // 已分配的字节数（含对齐填充）/ Bytes handed out (including alignment padding)
+    size_t reserved;        // 所有块的总容量 / Total capacity of all blocks
+} arena_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 初始化内存区域（不分配内存）/ Initialize an arena (allocates nothing)
+ * @param arena 内存区域 / Arena
+ * @param block_size 块大小，0表示ARENA_DEFAULT_BLOCK_SIZE / Block size, 0 for ARENA_DEFAULT_BLOCK_SIZE
+ */
+void arena_init(arena_t *arena, size_t block_size);
+
+/**
+ * 分配内存 / Allocate memory
+ *
+ * 当前块放得下时只是移动指针；超过块大小一半的请求单独占一块，不浪费当前块
+ * Only bumps a pointer when the current block has room; requests over half a block get
+ * their own block without abandoning the current one
+ *
+ * @param arena 内存区域 / Arena
+ * @param size 字节数 / Number of bytes
+ * @param align 对齐（2的幂）/ Alignment (a power of two)
+ * @return 内存指针，分配失败返回NULL / Pointer to memory, or NULL on failure
+ */
+void* arena_alloc(arena_t *arena, size_t size, size_t align);
+
+/**
+ * 复制字符串到内存区域 / Copy a string into the arena
+ * @param arena 内存区域 / Arena
+ * @param str 字符串（可以不以'\0'结尾）/ String (need not be '\0'-terminated)
+ * @param len 长度 / Length
+ * @return 以'\0'结尾的副本，失败返回NULL / '\0'-terminated copy, or NULL on failure
+ */
+char* arena_strndup(arena_t *arena, const char *str, size_t len);
+
+/**
+ * 释放所有分配，保留普通块供下次使用 / Release every allocation, keeping regular blocks for reuse
+ *
+ * 同样大小的工作负载在reset之后不再调用malloc / A same-sized workload after a reset calls malloc no more
+ * @param arena 内存区域 / Arena
+ */
+void arena_reset(arena_t *arena);
+
+/**
+ * 释放所有块 / Free every block
+ * @param arena 内存区域 / Arena
+ */
+void arena_free(arena_t *arena);
+
+#endif // ARENA_H
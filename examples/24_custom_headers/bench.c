@@ -0,0 +1,39 @@
+/**
+ * 基准测试辅助实现文件 / Benchmark Helper Implementation
+ */
+
+#include "bench.h"
+#include <stdio.h>    // 用于 printf / For printf
+#include <time.h>     // 用于 timespec_get / For timespec_get
+
+// 结果汇入volatile变量，编译器无法证明它无用
+// Results flow into a volatile the compiler cannot prove is unused
+static volatile uint64_t bench_sink;
+
+// 获取当前时间 / Get the current time
+double bench_now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);  // C11标准函数 / C11 standard function
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// 消费计算结果 / Consume a computed value
+void bench_consume(uint64_t value) {
+    bench_sink ^= value;
+}
+
+// 打印基准测试标题 / Print a benchmark title
+void bench_print_title(const char *title) {
+    printf("\n");
+    printf("========================================\n");
+    printf("  %s\n", title);
+    printf("========================================\n");
+}
+
+// 扩展性测试的下一个线程数 / Next thread count of a scaling run
+int bench_next_threads(int threads, int cores) {
+    if (threads < cores && threads * 2 > cores) {
+        return cores;
+    }
+    return threads * 2;
+}
@@ -0,0 +1,45 @@
+/**
+ * 基准测试辅助头文件 / Benchmark Helper Header
+ *
+ * 各bench_*.c程序共用的计时和输出函数
+ * Timing and reporting helpers shared by the bench_*.c programs
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>   // 用于 uint64_t / For uint64_t
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 获取当前时间 / Get the current time
+ * @return 秒（高精度）/ Seconds (high resolution)
+ */
+double bench_now(void);
+
+/**
+ * 防止编译器删除结果未被使用的计算 / Keep the compiler from discarding unused results
+ * @param value 计算结果 / Computed value
+ */
+void bench_consume(uint64_t value);
+
+/**
+ * 打印基准测试标题 / Print a benchmark title
+ * @param title 标题 / Title
+ */
+void bench_print_title(const char *title);
+
+/**
+ * 扩展性测试的下一个线程数：1, 2, 4 ...，最后一个是cores（即使它不是2的幂）
+ * Next thread count of a scaling run: 1, 2, 4 ..., ending at cores even when it is not a power of two
+ *
+ * @param threads 当前线程数 / Current thread count
+ * @param cores 最大线程数 / Largest thread count
+ * @return 下一个线程数，超过cores时结束 / Next thread count, above cores when the run is over
+ */
+int bench_next_threads(int threads, int cores);
+
+#endif // BENCH_H
@@ -0,0 +1,103 @@
+/**
+ * 流式统计累加器基准测试 / Streaming Statistics Accumulator Benchmark
+ *
+ * 把数组当作数据流，对比逐个utils_accum_add与按块utils_accum_add_array的吞吐量，
+ * 并与一次性的utils_array_stats比较结果
+ * Treats an array as a stream, compares the throughput of per-value utils_accum_add with per-block
+ * utils_accum_add_array, and checks the results against a one-shot utils_array_stats
+ *
+ * 用法 / Usage:
+ *   ./bench_accum [元素个数 / number of elements, default 16000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils.h"
+#include "bench.h"
+
+// 重复次数 / Repetitions
+#define REPEAT 3
+
+// 数据流每次到达的块大小 / Size of each block arriving from the stream
+#define BLOCK 4096
+
+static void print_row(const char *name, double seconds, const utils_accum_t *acc, size_t count) {
+    printf("  %-34s | %8.2f | %8.2f | %16.4f | %16.1f\n", name, seconds * 1e3,
+           (double)(count * sizeof(int)) / seconds / 1e9, acc->mean, utils_accum_variance(acc));
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 16000000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 16000000;
+        }
+    }
+    int *arr = malloc(count * sizeof(int));
+    if (arr == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < count; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        arr[i] = 1000000000 + (int)(state % 2000001) - 1000000;
+    }
+
+    bench_print_title("流式统计累加器 / Streaming Statistics Accumulator");
+    printf("  %zu 个int / ints, 块大小 / block size %d\n\n", count, BLOCK);
+    printf("  %-34s | %8s | %8s | %16s | %16s\n", "method", "ms", "GB/s", "mean", "variance");
+    printf("  -----------------------------------+----------+----------+------------------+-----------------\n");
+
+    utils_accum_t acc;
+    double start = bench_now();
+    for (int r = 0; r < REPEAT; r++) {
+        utils_accum_init(&acc);
+        for (size_t i = 0; i < count; i++) {
+            utils_accum_add(&acc, arr[i]);
+        }
+        bench_consume((uint64_t)acc.sum);
+    }
+    print_row("utils_accum_add (per value)", (bench_now() - start) / REPEAT, &acc, count);
+
+    start = bench_now();
+    for (int r = 0; r < REPEAT; r++) {
+        utils_accum_init(&acc);
+        for (size_t i = 0; i < count; i += BLOCK) {
+            utils_accum_add_array(&acc, arr + i, count - i < BLOCK ? count - i : BLOCK);
+        }
+        bench_consume((uint64_t)acc.sum);
+    }
+    print_row("utils_accum_add_array (per block)", (bench_now() - start) / REPEAT, &acc, count);
+
+    // 每个分段一个累加器，最后合并，相当于每个线程一个 / One accumulator per segment merged at the end, as with one per thread
+    enum { SEGMENTS = 8 };
+    utils_accum_t parts[SEGMENTS];
+    start = bench_now();
+    for (int r = 0; r < REPEAT; r++) {
+        for (size_t p = 0; p < SEGMENTS; p++) {
+            size_t lo = count * p / SEGMENTS, hi = count * (p + 1) / SEGMENTS;
+            utils_accum_init(&parts[p]);
+            utils_accum_add_array(&parts[p], arr + lo, hi - lo);
+        }
+        utils_accum_init(&acc);
+        for (size_t p = 0; p < SEGMENTS; p++) {
+            utils_accum_merge(&acc, &parts[p]);
+        }
+        bench_consume((uint64_t)acc.sum);
+    }
+    print_row("8 partials + utils_accum_merge", (bench_now() - start) / REPEAT, &acc, count);
+
+    utils_stats_t stats;
+    start = bench_now();
+    utils_array_stats(arr, count, &stats);
+    double t_stats = bench_now() - start;
+    printf("  %-34s | %8.2f | %8.2f | %16.4f | %16.1f\n", "utils_array_stats (whole array)", t_stats * 1e3,
+           (double)(count * sizeof(int)) / t_stats / 1e9, stats.mean, stats.variance);
+
+    free(arr);
+    return 0;
+}
@@ -0,0 +1,143 @@
+/**
+ * 内存区域基准测试 / Arena Benchmark
+ *
+ * 模拟逐个处理请求：每个请求把一批字符串去空白、转大写、反转，请求结束后释放全部结果。
+ *   - malloc：每个结果malloc一次，请求结束时逐个free
+ *   - arena：结果从内存区域分配，请求结束时arena_reset一次
+ * Simulates handling requests one by one: each request trims, uppercases and reverses a batch of
+ * strings, then releases every result when it ends.
+ *   - malloc: one malloc per result, each freed at the end of the request
+ *   - arena: results come from an arena, released with one arena_reset per request
+ *
+ * 用法 / Usage:
+ *   ./bench_arena [请求数 / number of requests, default 20000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "string_utils.h"
+#include "arena.h"
+#include "bench.h"
+
+// 每个请求的字符串数 / Strings per request
+#define STRINGS_PER_REQUEST 64
+
+// 每个字符串产生的结果数 / Results produced per string
+#define RESULTS_PER_STRING 3
+
+// malloc版本：与str_*_a做同样的工作 / malloc version: the same work as str_*_a
+static char* malloc_upper(const char *s, size_t len) {
+    char *r = malloc(len + 1);
+    if (r != NULL) {
+        for (size_t i = 0; i < len; i++) {
+            r[i] = (char)toupper((unsigned char)s[i]);
+        }
+        r[len] = '\0';
+    }
+    return r;
+}
+
+static char* malloc_reverse(const char *s, size_t len) {
+    char *r = malloc(len + 1);
+    if (r != NULL) {
+        for (size_t i = 0; i < len; i++) {
+            r[i] = s[len - 1 - i];
+        }
+        r[len] = '\0';
+    }
+    return r;
+}
+
+static char* malloc_trim(const char *s, size_t len) {
+    size_t start = 0, end = len;
+    while (start < end && isspace((unsigned char)s[start])) {
+        start++;
+    }
+    while (end > start && isspace((unsigned char)s[end - 1])) {
+        end--;
+    }
+    char *r = malloc(end - start + 1);
+    if (r != NULL) {
+        memcpy(r, s + start, end - start);
+        r[end - start] = '\0';
+    }
+    return r;
+}
+
+int main(int argc, char *argv[]) {
+    size_t requests = 20000;
+    if (argc > 1) {
+        requests = (size_t)strtoul(argv[1], NULL, 10);
+        if (requests == 0) {
+            requests = 20000;
+        }
+    }
+
+    // 长度从几字节到超过STR_BUFFER_SIZE的字符串 / Strings from a few bytes to past STR_BUFFER_SIZE
+    static char storage[STRINGS_PER_REQUEST][600];
+    str_view_t inputs[STRINGS_PER_REQUEST];
+    size_t total_len = 0;
+    for (size_t i = 0; i < STRINGS_PER_REQUEST; i++) {
+        size_t len = 4 + (i * 37) % 580;
+        for (size_t j = 0; j < len; j++) {
+            storage[i][j] = (j % 7 == 0) ? ' ' : (char)('a' + (i + j) % 26);
+        }
+        storage[i][len] = '\0';
+        inputs[i] = (str_view_t){ storage[i], len };
+        total_len += len;
+    }
+
+    bench_print_title("内存区域 vs malloc / Arena vs malloc");
+    printf("  %zu 个请求 × %d 个字符串 × %d 个结果，平均长度 %zu 字节\n",
+           requests, STRINGS_PER_REQUEST, RESULTS_PER_STRING, total_len / STRINGS_PER_REQUEST);
+    printf("  %zu requests x %d strings x %d results, %zu bytes on average\n\n",
+           requests, STRINGS_PER_REQUEST, RESULTS_PER_STRING, total_len / STRINGS_PER_REQUEST);
+
+    // malloc + free
+    char *results[STRINGS_PER_REQUEST * RESULTS_PER_STRING];
+    uint64_t acc = 0;
+    double start = bench_now();
+    for (size_t r = 0; r < requests; r++) {
+        size_t k = 0;
+        for (size_t i = 0; i < STRINGS_PER_REQUEST; i++) {
+            results[k++] = malloc_trim(inputs[i].data, inputs[i].len);
+            results[k++] = malloc_upper(inputs[i].data, inputs[i].len);
+            results[k++] = malloc_reverse(inputs[i].data, inputs[i].len);
+        }
+        for (size_t i = 0; i < k; i++) {
+            acc += results[i] != NULL ? (unsigned char)results[i][0] : 0;
+            free(results[i]);
+        }
+    }
+    double t_malloc = bench_now() - start;
+
+    // 内存区域 + reset / Arena + reset
+    arena_t arena;
+    arena_init(&arena, 0);
+    start = bench_now();
+    for (size_t r = 0; r < requests; r++) {
+        size_t k = 0;
+        for (size_t i = 0; i < STRINGS_PER_REQUEST; i++) {
+            results[k++] = str_trim_a(&arena, inputs[i]);
+            results[k++] = str_to_upper_a(&arena, inputs[i]);
+            results[k++] = str_reverse_a(&arena, inputs[i]);
+        }
+        for (size_t i = 0; i < k; i++) {
+            acc += results[i] != NULL ? (unsigned char)results[i][0] : 0;
+        }
+        arena_reset(&arena);
+    }
+    double t_arena = bench_now() - start;
+    arena_free(&arena);
+    bench_consume(acc);
+
+    double per_request = 1e9 / (double)requests;
+    printf("  %-16s | %12s | %8s\n", "method", "ns/request", "speedup");
+    printf("  -----------------+--------------+---------\n");
+    printf("  %-16s | %12.0f | %7.2fx\n", "malloc + free", t_malloc * per_request, 1.0);
+    printf("  %-16s | %12.0f | %7.2fx\n", "arena + reset", t_arena * per_request,
+           t_arena > 0 ? t_malloc / t_arena : 0.0);
+    return 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * 字符串构建器基准测试 / String Builder Benchmark
+ *
+ * 模拟报表生成：把成千上万个小片段拼成一个大输出。
+ *   - strcat：像examples/04_strings一样，每次追加都重新扫描目标串（平方复杂度）
+ *   - sb_append：块链表，均摊O(1)追加
+ * 然后对比"合并后write"与"sb_write_fd直接writev各块"的输出耗时。
+ * Simulates report generation: thousands of small fragments joined into one large output.
+ *   - strcat: like examples/04_strings, every append rescans the destination (quadratic)
+ *   - sb_append: chunk list, amortized O(1) append
+ * It then compares "flatten then write" against sb_write_fd writev-ing the chunks directly.
+ *
+ * 用法 / Usage:
+ *   ./bench_builder [片段数 / number of fragments, default 10000]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include "str_builder.h"
+#include "bench.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <io.h>
+    #define NULL_DEVICE "NUL"
+    #define open _open
+    #define write _write
+    #define close _close
+#else
+    #include <unistd.h>
+    #define NULL_DEVICE "/dev/null"
+#endif
+
+// 片段种类数 / Number of distinct fragments
+#define NUM_FRAGMENTS 64
+
+int main(int argc, char *argv[]) {
+    size_t count = 10000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 10000;
+        }
+    }
+
+    // 报表行片段 / Report line fragments
+    static char fragments[NUM_FRAGMENTS][48];
+    size_t total = 0;
+    for (size_t i = 0; i < NUM_FRAGMENTS; i++) {
+        snprintf(fragments[i], sizeof(fragments[i]), "row %zu: value=%zu status=%s\n",
+                 i, i * 7919 % 100000, (i % 3 == 0) ? "ok" : "pending");
+    }
+    for (size_t i = 0; i < count; i++) {
+        total += strlen(fragments[i % NUM_FRAGMENTS]);
+    }
+
+    bench_print_title("字符串构建器 / String Builder");
+    printf("  %zu 个片段，共 %zu 字节 / %zu fragments, %zu bytes in total\n\n",
+           count, total, count, total);
+
+    // strcat：每次追加都扫描已有内容 / strcat: every append scans what is already there
+    char *flat = malloc(total + 1);
+    if (flat == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    flat[0] = '\0';
+    double start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        strcat(flat, fragments[i % NUM_FRAGMENTS]);
+    }
+    double t_strcat = bench_now() - start;
+    bench_consume((unsigned char)flat[total / 2]);
+
+    // 构建器 / Builder
+    str_builder_t sb;
+    sb_init(&sb);
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        sb_append(&sb, fragments[i % NUM_FRAGMENTS]);
+    }
+    double t_builder = bench_now() - start;
+    bench_consume(sb_length(&sb));
+
+    double per_fragment = 1e9 / (double)count;
+    printf("  %-14s | %13s | %8s\n", "append", "ns/fragment", "speedup");
+    printf("  ---------------+---------------+---------\n");
+    printf("  %-14s | %13.1f | %7.2fx\n", "strcat", t_strcat * per_fragment, 1.0);
+    printf("  %-14s | %13.1f | %7.2fx\n", "sb_append", t_builder * per_fragment,
+           t_builder > 0 ? t_strcat / t_builder : 0.0);
+
+    // 输出到空设备 / Output to the null device
+    int fd = open(NULL_DEVICE, O_WRONLY);
+    if (fd >= 0) {
+        start = bench_now();
+        char *joined = sb_flatten(&sb);
+        bool ok = joined != NULL && write(fd, joined, (unsigned int)sb_length(&sb)) >= 0;
+        free(joined);
+        double t_flatten = bench_now() - start;
+
+        start = bench_now();
+        ok = sb_write_fd(&sb, fd) && ok;
+        double t_writev = bench_now() - start;
+        close(fd);
+
+        printf("\n  %-22s | %10s\n", "output", "us");
+        printf("  -----------------------+-----------\n");
+        printf("  %-22s | %10.1f\n", "sb_flatten + write", t_flatten * 1e6);
+        printf("  %-22s | %10.1f\n", "sb_write_fd (writev)", t_writev * 1e6);
+        printf("  %zu 个块 / chunks%s\n", sb.chunks, ok ? "" : "，写入失败 / write failed");
+    }
+
+    sb_free(&sb);
+    free(flat);
+    return 0;
+}
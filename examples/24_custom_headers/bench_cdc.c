@@ -0,0 +1,180 @@
+/**
+ * 内容定义分块基准测试 / Content-Defined Chunking Benchmark
+ *
+ * 输出 / Reports:
+ *   - cdc_next的分块吞吐量、指纹吞吐量和去重存储的端到端吞吐量
+ *     Chunking throughput of cdc_next, fingerprint throughput and end-to-end dedupe store throughput
+ *   - 对同一份数据的几个修改版本去重：内容定义分块与固定大小分块各需保存多少字节
+ *     Deduplicating several edited versions of the same data: bytes stored with content-defined versus
+ *     fixed-size chunks
+ *
+ * 用法 / Usage:
+ *   ./bench_cdc [数据MB数 / data size in MB, default 64]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cdc.h"
+#include "bench.h"
+
+// 修改版本数和每个版本的编辑次数 / Number of edited versions and edits per version
+#define NUM_VERSIONS 8
+#define EDITS_PER_VERSION 20
+
+static uint64_t rng_state = 88172645463325252ull;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void fill_random(unsigned char *data, size_t len) {
+    for (size_t i = 0; i < len; i += 8) {
+        uint64_t r = next_random();
+        memcpy(data + i, &r, len - i < 8 ? len - i : 8);
+    }
+}
+
+// 在src中随机插入或删除几个字节，结果写入dst，返回新长度
+// Randomly insert or delete a few bytes of src into dst and return the new length
+static size_t edit(const unsigned char *src, size_t len, unsigned char *dst) {
+    size_t cuts[EDITS_PER_VERSION];
+    for (int e = 0; e < EDITS_PER_VERSION; e++) {
+        cuts[e] = (size_t)(next_random() % len);
+    }
+    // 编辑位置升序 / Edit positions in ascending order
+    for (int a = 1; a < EDITS_PER_VERSION; a++) {
+        for (int b = a; b > 0 && cuts[b - 1] > cuts[b]; b--) {
+            size_t t = cuts[b];
+            cuts[b] = cuts[b - 1];
+            cuts[b - 1] = t;
+        }
+    }
+    size_t in = 0, out = 0;
+    for (int e = 0; e < EDITS_PER_VERSION; e++) {
+        memcpy(dst + out, src + in, cuts[e] - in);
+        out += cuts[e] - in;
+        in = cuts[e];
+        size_t n = 1 + next_random() % 16;
+        if (next_random() & 1) {
+            fill_random(dst + out, n);      // 插入 / Insert
+            out += n;
+        } else {
+            in += in + n <= len ? n : 0;    // 删除 / Delete
+        }
+    }
+    memcpy(dst + out, src + in, len - in);
+    return out + len - in;
+}
+
+// 固定大小分块，作为对照 / Fixed-size chunking, for comparison
+static bool add_fixed(cdc_store_t *store, const unsigned char *data, size_t len, size_t size) {
+    for (size_t i = 0; i < len; i += size) {
+        if (!cdc_store_put(store, data + i, len - i < size ? len - i : size, NULL)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    size_t megabytes = 64;
+    if (argc > 1) {
+        megabytes = (size_t)strtoul(argv[1], NULL, 10);
+        if (megabytes == 0) {
+            megabytes = 64;
+        }
+    }
+    size_t len = megabytes * 1024 * 1024;
+    unsigned char *data = malloc(len);
+    if (data == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    fill_random(data, len);
+
+    cdc_chunker_t chunker;
+    cdc_init(&chunker, CDC_DEFAULT_MIN, CDC_DEFAULT_AVG, CDC_DEFAULT_MAX);
+
+    bench_print_title("内容定义分块 / Content-Defined Chunking");
+    printf("  %zu MB 随机数据 / of random data, 块大小 / chunk sizes %d / %d / %d\n\n",
+           megabytes, CDC_DEFAULT_MIN, CDC_DEFAULT_AVG, CDC_DEFAULT_MAX);
+
+    // 吞吐量 / Throughput
+    size_t chunks = 0;
+    double start = bench_now();
+    for (size_t pos = 0; pos < len; chunks++) {
+        pos += cdc_next(&chunker, data + pos, len - pos);
+    }
+    double t_chunk = bench_now() - start;
+
+    uint64_t acc = 0;
+    start = bench_now();
+    for (size_t pos = 0; pos < len; pos += CDC_DEFAULT_AVG) {
+        acc += cdc_fingerprint(data + pos, len - pos < CDC_DEFAULT_AVG ? len - pos : CDC_DEFAULT_AVG).lo;
+    }
+    double t_fingerprint = bench_now() - start;
+    bench_consume(acc);
+
+    cdc_store_t store;
+    if (!cdc_store_open(&store, NULL)) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        free(data);
+        return 1;
+    }
+    start = bench_now();
+    cdc_store_add_buffer(&store, &chunker, data, len);
+    double t_store = bench_now() - start;
+    cdc_store_close(&store);
+
+    printf("  %-34s | %10s\n", "stage", "GB/s");
+    printf("  -----------------------------------+-----------\n");
+    printf("  %-34s | %10.2f\n", "cdc_next (chunking)", (double)len / t_chunk / 1e9);
+    printf("  %-34s | %10.2f\n", "cdc_fingerprint", (double)len / t_fingerprint / 1e9);
+    printf("  %-34s | %10.2f\n", "cdc_store_add_buffer (no pack)", (double)len / t_store / 1e9);
+    printf("  平均块大小 / Average chunk: %zu 字节 / bytes\n\n", len / chunks);
+
+    // 修改版本去重 / Deduplicating edited versions
+    size_t version_len = len / 4;
+    unsigned char *versions[2];
+    versions[0] = malloc(version_len + NUM_VERSIONS * EDITS_PER_VERSION * 16);
+    versions[1] = malloc(version_len + NUM_VERSIONS * EDITS_PER_VERSION * 16);
+    cdc_store_t cdc_store, fixed_store;
+    if (versions[0] == NULL || versions[1] == NULL ||
+        !cdc_store_open(&cdc_store, NULL) || !cdc_store_open(&fixed_store, NULL)) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    memcpy(versions[0], data, version_len);
+    size_t current_len = version_len;
+    uint64_t total = 0;
+    for (int v = 0; v <= NUM_VERSIONS; v++) {
+        const unsigned char *current = versions[v % 2];
+        cdc_store_add_buffer(&cdc_store, &chunker, current, current_len);
+        add_fixed(&fixed_store, current, current_len, CDC_DEFAULT_AVG);
+        total += current_len;
+        if (v < NUM_VERSIONS) {
+            current_len = edit(current, current_len, versions[(v + 1) % 2]);
+        }
+    }
+    printf("  %d 个版本，每个相对上一个有 %d 处小的插入/删除，共 %.1f MB\n",
+           NUM_VERSIONS + 1, EDITS_PER_VERSION, (double)total / 1e6);
+    printf("  %d versions, each with %d small inserts/deletes relative to the previous, %.1f MB in total\n\n",
+           NUM_VERSIONS + 1, EDITS_PER_VERSION, (double)total / 1e6);
+    printf("  %-34s | %12s | %8s\n", "chunking", "stored MB", "ratio");
+    printf("  -----------------------------------+--------------+---------\n");
+    printf("  %-34s | %12.1f | %7.2fx\n", "fixed 8 KB", (double)fixed_store.stats.bytes_stored / 1e6,
+           (double)total / (double)fixed_store.stats.bytes_stored);
+    printf("  %-34s | %12.1f | %7.2fx\n", "content-defined (FastCDC)", (double)cdc_store.stats.bytes_stored / 1e6,
+           (double)total / (double)cdc_store.stats.bytes_stored);
+
+    cdc_store_close(&cdc_store);
+    cdc_store_close(&fixed_store);
+    free(versions[0]);
+    free(versions[1]);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,173 @@
+/**
+ * 前缀压缩字典基准测试 / Front-Coded Dictionary Benchmark
+ *
+ * 对一组有序书名对比两种保存方式：
+ *   - char*数组：每个书名单独malloc（像createBook一样），用bsearch + strcmp查找
+ *   - str_dict：前缀压缩字典
+ * 输出内存占用、查找和取出的耗时。
+ * Compares two ways of holding a sorted list of book titles:
+ *   - char* array: one malloc per title (like createBook), looked up with bsearch + strcmp
+ *   - str_dict: the front-coded dictionary
+ * and reports memory, lookup time and extraction time.
+ *
+ * 用法 / Usage:
+ *   ./bench_dict [书名数 / number of titles, default 200000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "str_dict.h"
+#include "str_sort.h"
+#include "bench.h"
+
+static const char *SUBJECTS[] = {
+    "Algorithms", "Compilers", "Computer Programming", "Databases", "Distributed Systems",
+    "Networking", "Operating Systems", "Programming Languages", "Software Engineering",
+    "Computer Graphics", "Machine Learning", "Cryptography", "Information Theory",
+};
+
+static const char *FORMS[] = {
+    "The Art of ", "Introduction to ", "Principles of ", "Advanced ", "A Practical Guide to ",
+    "Foundations of ", "Handbook of ",
+};
+
+#define NUM_SUBJECTS (sizeof(SUBJECTS) / sizeof(SUBJECTS[0]))
+#define NUM_FORMS (sizeof(FORMS) / sizeof(FORMS[0]))
+
+// 每次lookup/extract测量的操作数 / Operations per lookup/extract measurement
+#define NUM_QUERIES 200000
+
+static int compare_strcmp(const void *a, const void *b) {
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+// glibc风格的malloc块大小：8字节头部，16字节对齐，最小32字节
+// glibc-style malloc chunk size: 8-byte header, 16-byte granularity, 32 bytes minimum
+static size_t malloc_chunk_size(size_t request) {
+    size_t chunk = (request + 8 + 15) & ~(size_t)15;
+    return chunk < 32 ? 32 : chunk;
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 200000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 200000;
+        }
+    }
+
+    // 生成不重复的书名并排序 / Generate distinct titles and sort them
+    char **titles = malloc(count * sizeof(char *));
+    if (titles == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    size_t string_bytes = 0, malloc_bytes = 0;
+    for (size_t i = 0; i < count; i++) {
+        char buf[128];
+        int len = snprintf(buf, sizeof(buf), "%s%s, Volume %zu",
+                           FORMS[i % NUM_FORMS], SUBJECTS[(i / NUM_FORMS) % NUM_SUBJECTS],
+                           i / (NUM_FORMS * NUM_SUBJECTS) + 1);
+        titles[i] = malloc((size_t)len + 1);
+        if (titles[i] == NULL) {
+            fprintf(stderr, "内存不足 / Out of memory\n");
+            return 1;
+        }
+        memcpy(titles[i], buf, (size_t)len + 1);
+        string_bytes += (size_t)len + 1;
+        malloc_bytes += malloc_chunk_size((size_t)len + 1);
+    }
+    str_sort((const char **)titles, count);
+
+    str_dict_t dict;
+    if (!str_dict_build(&dict, (const char *const *)titles, count)) {
+        fprintf(stderr, "构建失败 / Build failed\n");
+        return 1;
+    }
+
+    bench_print_title("前缀压缩字典 / Front-Coded Dictionary");
+    printf("  %zu 个书名，例如 \"%s\" / %zu titles, e.g. \"%s\"\n\n",
+           count, titles[count / 2], count, titles[count / 2]);
+
+    // 内存 / Memory
+    size_t array_bytes = count * sizeof(char *);
+    size_t dict_bytes = str_dict_memory(&dict);
+    printf("  %-34s | %12s | %7s\n", "storage", "bytes", "ratio");
+    printf("  -----------------------------------+--------------+--------\n");
+    printf("  %-34s | %12zu | %6.1fx\n", "char* + malloc per title (est.)",
+           array_bytes + malloc_bytes, (double)(array_bytes + malloc_bytes) / (double)dict_bytes);
+    printf("  %-34s | %12zu | %6.1fx\n", "char* + string bytes only",
+           array_bytes + string_bytes, (double)(array_bytes + string_bytes) / (double)dict_bytes);
+    printf("  %-34s | %12zu | %6.1fx\n", "str_dict", dict_bytes, 1.0);
+
+    // 查询顺序随机 / Queries in random order
+    size_t *ids = malloc(NUM_QUERIES * sizeof(size_t));
+    size_t *lens = malloc(NUM_QUERIES * sizeof(size_t));
+    if (ids == NULL || lens == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < NUM_QUERIES; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        ids[i] = state % count;
+        lens[i] = strlen(titles[ids[i]]);
+    }
+
+    uint64_t acc = 0;
+    double start = bench_now();
+    for (size_t i = 0; i < NUM_QUERIES; i++) {
+        const char *key = titles[ids[i]];
+        char **found = bsearch(&key, titles, count, sizeof(char *), compare_strcmp);
+        acc += found != NULL ? (size_t)(found - titles) : 0;
+    }
+    double t_bsearch = bench_now() - start;
+
+    size_t wrong = 0;
+    start = bench_now();
+    for (size_t i = 0; i < NUM_QUERIES; i++) {
+        size_t id = str_dict_lookup(&dict, titles[ids[i]], lens[i]);
+        wrong += id != ids[i];
+        acc += id;
+    }
+    double t_lookup = bench_now() - start;
+
+    char *buffer = malloc(dict.max_length + 1);
+    if (buffer == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    start = bench_now();
+    for (size_t i = 0; i < NUM_QUERIES; i++) {
+        acc += str_dict_extract(&dict, ids[i], buffer, dict.max_length + 1);
+    }
+    double t_extract = bench_now() - start;
+    bench_consume(acc);
+
+    size_t first, end;
+    str_dict_prefix_range(&dict, "The Art of ", 11, &first, &end);
+
+    double per_query = 1e9 / NUM_QUERIES;
+    printf("\n  %-34s | %12s\n", "operation", "ns/query");
+    printf("  -----------------------------------+--------------\n");
+    printf("  %-34s | %12.1f\n", "bsearch + strcmp (char* array)", t_bsearch * per_query);
+    printf("  %-34s | %12.1f%s\n", "str_dict_lookup", t_lookup * per_query,
+           wrong == 0 ? "" : "  (结果错误 / WRONG)");
+    printf("  %-34s | %12.1f\n", "str_dict_extract", t_extract * per_query);
+    printf("\n  前缀 \"The Art of \" 的ID范围 / ID range of prefix \"The Art of \": [%zu, %zu)\n",
+           first, end);
+
+    free(buffer);
+    free(ids);
+    free(lens);
+    str_dict_free(&dict);
+    for (size_t i = 0; i < count; i++) {
+        free(titles[i]);
+    }
+    free(titles);
+    return 0;
+}
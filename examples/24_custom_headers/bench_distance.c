@@ -0,0 +1,152 @@
+/**
+ * 编辑距离基准测试 / Edit Distance Benchmark
+ *
+ * 一个查询名字对比大量候选名字：经典O(n·m)动态规划、Myers位并行、
+ * 带上限的提前退出版本和SIMD批量版本
+ * One query name against many candidate names: classic O(n·m) dynamic programming,
+ * Myers' bit-parallel, the bounded early-exit variant and the SIMD batch variant
+ *
+ * 用法 / Usage:
+ *   ./bench_distance [候选串个数 / number of candidates, default 200000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "str_distance.h"
+#include "bench.h"
+
+// 每个名字的存储空间 / Storage per name
+#define NAME_MAX_LEN 24
+
+// 模糊匹配的距离上限 / Distance bound for a fuzzy match
+#define BOUND 4
+
+// 把宏的值变成字符串 / Turn a macro's value into a string
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+// 经典两行动态规划，作为对照 / Classic two-row dynamic programming, as the baseline
+static size_t dp_distance(const char *a, size_t n, const char *b, size_t m, size_t *row) {
+    for (size_t j = 0; j <= m; j++) {
+        row[j] = j;
+    }
+    for (size_t i = 1; i <= n; i++) {
+        size_t diag = row[0];
+        row[0] = i;
+        for (size_t j = 1; j <= m; j++) {
+            size_t up = row[j];
+            size_t best = diag + (a[i - 1] != b[j - 1]);
+            if (up + 1 < best) {
+                best = up + 1;
+            }
+            if (row[j - 1] + 1 < best) {
+                best = row[j - 1] + 1;
+            }
+            row[j] = best;
+            diag = up;
+        }
+    }
+    return row[m];
+}
+
+// 生成一个由音节拼成的名字 / Generate a name made of syllables
+static size_t make_name(char *out, unsigned *seed) {
+    static const char *const syllables[] = {
+        "an", "be", "ca", "da", "el", "fi", "go", "ha", "in", "jo",
+        "ka", "li", "ma", "no", "or", "pe", "ra", "si", "ta", "vi"
+    };
+    size_t len = 0;
+    int count = 4 + (int)(*seed % 6);
+    for (int i = 0; i < count; i++) {
+        *seed = *seed * 1103515245u + 12345u;
+        const char *s = syllables[(*seed >> 16) % 20];
+        memcpy(out + len, s, 2);
+        len += 2;
+    }
+    out[len] = '\0';
+    return len;
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 200000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 200000;
+        }
+    }
+
+    char *storage = malloc(count * NAME_MAX_LEN);
+    const char **names = malloc(count * sizeof(*names));
+    size_t *lens = malloc(count * sizeof(*lens));
+    size_t *distances = malloc(count * sizeof(*distances));
+    if (storage == NULL || names == NULL || lens == NULL || distances == NULL) {
+        fprintf(stderr, "内存分配失败 / Memory allocation failed\n");
+        free(storage);
+        free(names);
+        free(lens);
+        free(distances);
+        return 1;
+    }
+
+    unsigned seed = 42;
+    for (size_t i = 0; i < count; i++) {
+        names[i] = storage + i * NAME_MAX_LEN;
+        lens[i] = make_name(storage + i * NAME_MAX_LEN, &seed);
+    }
+    const char *query = "malinovitaka";
+    size_t query_len = strlen(query);
+    size_t row[NAME_MAX_LEN + 1];
+
+    bench_print_title("编辑距离 / Edit Distance");
+    printf("  查询 / Query: \"%s\", 候选串 / Candidates: %zu\n\n", query, count);
+    printf("  %-28s | %10s | %9s | %s\n", "method", "ns/pair", "speedup", "matches <= " STR(BOUND));
+    printf("  -----------------------------+------------+-----------+-------------\n");
+
+    // 动态规划 / Dynamic programming
+    size_t matches = 0;
+    double start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        matches += dp_distance(query, query_len, names[i], lens[i], row) <= BOUND;
+    }
+    double t_dp = bench_now() - start;
+    printf("  %-28s | %10.1f | %8.1fx | %zu\n", "DP O(n*m)", t_dp * 1e9 / count, 1.0, matches);
+
+    // Myers位并行 / Myers bit-parallel
+    matches = 0;
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        matches += str_edit_distance(query, query_len, names[i], lens[i]) <= BOUND;
+    }
+    double t = bench_now() - start;
+    printf("  %-28s | %10.1f | %8.1fx | %zu\n", "str_edit_distance",
+           t * 1e9 / count, t > 0 ? t_dp / t : 0.0, matches);
+
+    // 带上限 / Bounded
+    matches = 0;
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        matches += str_edit_distance_bounded(query, query_len, names[i], lens[i], BOUND) <= BOUND;
+    }
+    t = bench_now() - start;
+    printf("  %-28s | %10.1f | %8.1fx | %zu\n", "str_edit_distance_bounded(" STR(BOUND) ")",
+           t * 1e9 / count, t > 0 ? t_dp / t : 0.0, matches);
+
+    // 批量 / Batch
+    matches = 0;
+    start = bench_now();
+    str_edit_distance_batch(query, query_len, names, lens, count, distances);
+    for (size_t i = 0; i < count; i++) {
+        matches += distances[i] <= BOUND;
+    }
+    t = bench_now() - start;
+    printf("  %-28s | %10.1f | %8.1fx | %zu\n", "str_edit_distance_batch",
+           t * 1e9 / count, t > 0 ? t_dp / t : 0.0, matches);
+
+    free(storage);
+    free(names);
+    free(lens);
+    free(distances);
+    return 0;
+}
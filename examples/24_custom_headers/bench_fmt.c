@@ -0,0 +1,158 @@
+/**
+ * 数值格式化基准测试 / Number Formatting Benchmark
+ *
+ * 对比 fmt_u64、fmt_i64、fmt_double 和只追加格式化器与 snprintf：
+ *   - 整数：位数均匀分布在1..20位，避免只测到短数字
+ *   - double：随机尾数，snprintf用"%.17g"（能往返的最短固定格式）
+ *   - 一行记录："id=<u64> delta=<i64> score=<double>\n"，fmt_append_* 与一次snprintf
+ * Compares fmt_u64, fmt_i64, fmt_double and the append-only formatter with snprintf:
+ *   - integers: digit counts spread evenly over 1..20, so short numbers do not dominate
+ *   - doubles: random mantissas, snprintf with "%.17g" (the shortest fixed format that round-trips)
+ *   - one record line: "id=<u64> delta=<i64> score=<double>\n", fmt_append_* versus one snprintf
+ *
+ * 用法 / Usage:
+ *   ./bench_fmt [数值个数 / number of values, default 1000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "fmt.h"
+#include "bench.h"
+
+static uint64_t xorshift(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+// 打印一行结果 / Print one result row
+static void print_row(const char *name, double t_fmt, double t_snprintf, size_t count) {
+    double per_value = 1e9 / (double)count;
+    printf("  %-22s | %10.1f | %13.1f | %7.2fx\n", name, t_fmt * per_value, t_snprintf * per_value,
+           t_fmt > 0 ? t_snprintf / t_fmt : 0.0);
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 1000000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 1000000;
+        }
+    }
+
+    uint64_t *unsigned_values = malloc(count * sizeof(uint64_t));
+    int64_t *signed_values = malloc(count * sizeof(int64_t));
+    double *double_values = malloc(count * sizeof(double));
+    if (unsigned_values == NULL || signed_values == NULL || double_values == NULL) {
+        fprintf(stderr, "内存分配失败 / Memory allocation failed\n");
+        free(unsigned_values);
+        free(signed_values);
+        free(double_values);
+        return 1;
+    }
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t x = xorshift(&state);
+        unsigned_values[i] = x >> (x % 64);
+        signed_values[i] = (int64_t)(xorshift(&state) >> (x % 64)) * ((x & 1) ? -1 : 1);
+        double_values[i] = (double)(xorshift(&state) >> 11) * 0x1.0p-53 * 1e6 - 5e5;
+    }
+
+    bench_print_title("数值格式化 / Number Formatting");
+    printf("  %zu 个数值 / values\n\n", count);
+    printf("  %-22s | %10s | %13s | %8s\n", "function", "fmt ns", "snprintf ns", "speedup");
+    printf("  -----------------------+------------+---------------+---------\n");
+
+    char buf[FMT_DOUBLE_SIZE];
+    char check[FMT_DOUBLE_SIZE];
+    uint64_t acc = 0;
+    int ok = 1;
+
+    // 无符号整数 / Unsigned integers
+    double start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        acc += fmt_u64(buf, unsigned_values[i]);
+    }
+    double t_fmt = bench_now() - start;
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        acc += (uint64_t)snprintf(buf, sizeof(buf), "%" PRIu64, unsigned_values[i]);
+    }
+    double t_snprintf = bench_now() - start;
+    print_row("fmt_u64 / PRIu64", t_fmt, t_snprintf, count);
+
+    // 有符号整数 / Signed integers
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        acc += fmt_i64(buf, signed_values[i]);
+    }
+    t_fmt = bench_now() - start;
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        acc += (uint64_t)snprintf(buf, sizeof(buf), "%" PRId64, signed_values[i]);
+    }
+    t_snprintf = bench_now() - start;
+    print_row("fmt_i64 / PRId64", t_fmt, t_snprintf, count);
+
+    // double / Doubles
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        acc += fmt_double(buf, double_values[i]);
+    }
+    t_fmt = bench_now() - start;
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        acc += (uint64_t)snprintf(buf, sizeof(buf), "%.17g", double_values[i]);
+    }
+    t_snprintf = bench_now() - start;
+    print_row("fmt_double / %.17g", t_fmt, t_snprintf, count);
+
+    // 一行记录 / One record line
+    char line[128];
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        fmt_buf_t out;
+        fmt_init(&out, line, sizeof(line));
+        fmt_append_str(&out, "id=");
+        fmt_append_u64(&out, unsigned_values[i]);
+        fmt_append_str(&out, " delta=");
+        fmt_append_i64(&out, signed_values[i]);
+        fmt_append_str(&out, " score=");
+        fmt_append_double(&out, double_values[i]);
+        fmt_append_char(&out, '\n');
+        acc += out.len;
+    }
+    t_fmt = bench_now() - start;
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        acc += (uint64_t)snprintf(line, sizeof(line), "id=%" PRIu64 " delta=%" PRId64 " score=%.17g\n",
+                                  unsigned_values[i], signed_values[i], double_values[i]);
+    }
+    t_snprintf = bench_now() - start;
+    print_row("fmt_append_* / line", t_fmt, t_snprintf, count);
+    bench_consume(acc);
+
+    // 整数必须与snprintf逐字相同，double必须往返 / Integers must match snprintf, doubles must round-trip
+    for (size_t i = 0; i < count && ok; i++) {
+        buf[fmt_u64(buf, unsigned_values[i])] = '\0';
+        snprintf(check, sizeof(check), "%" PRIu64, unsigned_values[i]);
+        ok = strcmp(buf, check) == 0;
+        buf[fmt_i64(buf, signed_values[i])] = '\0';
+        snprintf(check, sizeof(check), "%" PRId64, signed_values[i]);
+        ok = ok && strcmp(buf, check) == 0;
+        buf[fmt_double(buf, double_values[i])] = '\0';
+        ok = ok && strtod(buf, NULL) == double_values[i];
+    }
+    printf("\n  结果检查 / Result check: %s\n", ok ? "ok" : "FAIL");
+
+    free(unsigned_values);
+    free(signed_values);
+    free(double_values);
+    return ok ? 0 : 1;
+}
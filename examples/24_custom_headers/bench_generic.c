@@ -0,0 +1,97 @@
+/**
+ * 类型泛型数组函数基准测试 / Type-Generic Array Functions Benchmark
+ *
+ * 对比两种做法求uint8/int16/int64/float/double数组的sum、max、min：
+ *   - 先复制成临时int数组，再调用utils_array_sum/max/min
+ *   - 用UTILS_ARRAY_SUM/MAX/MIN直接调用对应类型的函数
+ * Compares two ways to take the sum, max and min of uint8/int16/int64/float/double arrays:
+ *   - copy into a temporary int array, then call utils_array_sum/max/min
+ *   - call the function for the element type directly with UTILS_ARRAY_SUM/MAX/MIN
+ *
+ * 用法 / Usage:
+ *   ./bench_generic [元素个数 / number of elements, default 8000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils.h"
+#include "utils_generic.h"
+#include "bench.h"
+
+// 重复次数 / Repetitions
+#define REPEAT 5
+
+static uint64_t rng_state = 88172645463325252ull;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+// 对一种类型计时并打印一行 / Time one type and print a row
+#define BENCH_TYPE(T, name, fill)                                                              \
+    do {                                                                                       \
+        T *arr = malloc(count * sizeof(T));                                                    \
+        if (arr == NULL) {                                                                     \
+            fprintf(stderr, "内存不足 / Out of memory\n");                                     \
+            return 1;                                                                          \
+        }                                                                                      \
+        for (size_t i = 0; i < count; i++) {                                                   \
+            arr[i] = (T)(fill);                                                                \
+        }                                                                                      \
+        double start = bench_now();                                                            \
+        for (int r = 0; r < REPEAT; r++) {                                                     \
+            int *copy = malloc(count * sizeof(int));                                           \
+            if (copy == NULL) {                                                                \
+                fprintf(stderr, "内存不足 / Out of memory\n");                                 \
+                return 1;                                                                      \
+            }                                                                                  \
+            for (size_t i = 0; i < count; i++) {                                               \
+                copy[i] = (int)arr[i];                                                         \
+            }                                                                                  \
+            int max = 0, min = 0;                                                              \
+            long sum = utils_array_sum(copy, count);                                           \
+            utils_array_max(copy, count, &max);                                                \
+            utils_array_min(copy, count, &min);                                                \
+            bench_consume((uint64_t)sum + (uint64_t)max + (uint64_t)min);                      \
+            free(copy);                                                                        \
+        }                                                                                      \
+        double t_copy = (bench_now() - start) / REPEAT;                                        \
+        start = bench_now();                                                                   \
+        for (int r = 0; r < REPEAT; r++) {                                                     \
+            T max = 0, min = 0;                                                                \
+            double sum = (double)UTILS_ARRAY_SUM(arr, count);                                  \
+            UTILS_ARRAY_MAX(arr, count, &max);                                                 \
+            UTILS_ARRAY_MIN(arr, count, &min);                                                 \
+            bench_consume((uint64_t)(int64_t)(sum + (double)max + (double)min));               \
+        }                                                                                      \
+        double t_generic = (bench_now() - start) / REPEAT;                                     \
+        printf("  %-8s | %16.2f | %16.2f | %7.2fx\n", name, t_copy * 1e3, t_generic * 1e3,     \
+               t_generic > 0 ? t_copy / t_generic : 0.0);                                      \
+        free(arr);                                                                             \
+    } while (0)
+
+int main(int argc, char *argv[]) {
+    size_t count = 8000000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 8000000;
+        }
+    }
+
+    bench_print_title("类型泛型数组函数 / Type-Generic Array Functions");
+    printf("  %zu 个元素，sum + max + min / elements, sum + max + min\n\n", count);
+    printf("  %-8s | %16s | %16s | %8s\n", "type", "copy to int ms", "generic ms", "speedup");
+    printf("  ---------+------------------+------------------+---------\n");
+
+    BENCH_TYPE(uint8_t, "uint8", next_random());
+    BENCH_TYPE(int16_t, "int16", next_random());
+    BENCH_TYPE(int64_t, "int64", (int64_t)(next_random() >> 34));
+    BENCH_TYPE(float, "float", (double)(next_random() >> 40) / 7.0);
+    BENCH_TYPE(double, "double", (double)(next_random() >> 40) / 7.0);
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+/**
+ * 通配符匹配基准测试 / Glob Matching Benchmark
+ *
+ * 递归回溯匹配与编译后的 glob_match 对比：
+ *   1. 病态输入："*a*a*a*a*b*" 匹配一串'a'，回溯是多项式爆炸，glob_match保持线性
+ *   2. 文件过滤：一组常见模式匹配大量路径
+ * Recursive backtracking versus the compiled glob_match:
+ *   1. Pathological input: "*a*a*a*a*b*" against a run of 'a's; backtracking blows up
+ *      polynomially while glob_match stays linear
+ *   2. File filtering: a few common patterns against many paths
+ *
+ * 用法 / Usage:
+ *   ./bench_glob [路径数 / number of paths, default 100000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "str_glob.h"
+#include "bench.h"
+
+// 常见的递归写法（只支持'*'和'?'）/ The usual recursive version ('*' and '?' only)
+static int naive_match(const char *pattern, const char *str) {
+    if (*pattern == '\0') {
+        return *str == '\0';
+    }
+    if (*pattern == '*') {
+        for (const char *s = str; ; s++) {
+            if (naive_match(pattern + 1, s)) {
+                return 1;
+            }
+            if (*s == '\0') {
+                return 0;
+            }
+        }
+    }
+    if (*str != '\0' && (*pattern == '?' || *pattern == *str)) {
+        return naive_match(pattern + 1, str + 1);
+    }
+    return 0;
+}
+
+static void bench_pathological(void) {
+    const char *pattern = "*a*a*a*a*b*";
+    glob_pattern_t *glob = glob_compile(pattern);
+    enum { MAX_TEXT = 1 << 16, NAIVE_MAX = 64 };
+    char *text = malloc(MAX_TEXT + 1);
+    if (glob == NULL || text == NULL) {
+        fprintf(stderr, "内存分配失败 / Memory allocation failed\n");
+        glob_free(glob);
+        free(text);
+        return;
+    }
+
+    printf("  模式 / Pattern: \"%s\"，文本为n个'a' / text is n 'a's\n\n", pattern);
+    printf("  %6s | %16s | %16s\n", "n", "naive (us)", "glob_match (us)");
+    printf("  -------+------------------+-----------------\n");
+
+    for (size_t n = 16; n <= MAX_TEXT; n *= 4) {
+        memset(text, 'a', n);
+        text[n] = '\0';
+
+        int r1 = 0;
+        double t_naive = 0;
+        if (n <= NAIVE_MAX) {
+            double start = bench_now();
+            r1 = naive_match(pattern, text);
+            t_naive = bench_now() - start;
+        }
+
+        int repeat = (int)(MAX_TEXT / n);
+        double start = bench_now();
+        int r2 = 0;
+        for (int i = 0; i < repeat; i++) {
+            r2 += glob_match(glob, text);
+        }
+        double t_glob = (bench_now() - start) / repeat;
+        bench_consume((uint64_t)(r1 + r2));
+
+        if (n <= NAIVE_MAX) {
+            printf("  %6zu | %16.1f | %16.3f\n", n, t_naive * 1e6, t_glob * 1e6);
+        } else {
+            // 递归版本在这里要跑几秒到几年 / The recursive version would take seconds to years here
+            printf("  %6zu | %16s | %16.3f\n", n, "-", t_glob * 1e6);
+        }
+    }
+    glob_free(glob);
+    free(text);
+}
+
+static void bench_paths(size_t count) {
+    static const char *const dirs[] = { "src", "include", "build/obj", "docs", "tests/unit" };
+    static const char *const names[] = { "main", "utils", "string_utils", "parser", "server_log" };
+    static const char *const exts[] = { ".c", ".h", ".o", ".md", ".log", ".txt" };
+    static const char *const patterns[] = { "*.c", "src/*", "*utils*.[ch]", "*/*_log*.?og", "*test*unit*" };
+    const size_t npatterns = sizeof(patterns) / sizeof(patterns[0]);
+
+    char *storage = malloc(count * 48);
+    if (storage == NULL) {
+        fprintf(stderr, "内存分配失败 / Memory allocation failed\n");
+        return;
+    }
+    unsigned seed = 7;
+    for (size_t i = 0; i < count; i++) {
+        seed = seed * 1103515245u + 12345u;
+        snprintf(storage + i * 48, 48, "%s/%s%u%s", dirs[(seed >> 8) % 5], names[(seed >> 12) % 5],
+                 (seed >> 16) % 100, exts[(seed >> 20) % 6]);
+    }
+
+    printf("\n  %zu 个路径 / paths\n\n", count);
+    printf("  %-14s | %8s | %12s | %12s | %7s\n", "pattern", "matches", "naive ns", "glob ns", "speedup");
+    printf("  ---------------+----------+--------------+--------------+--------\n");
+
+    for (size_t p = 0; p < npatterns; p++) {
+        glob_pattern_t *glob = glob_compile(patterns[p]);
+        // 递归版本不支持[...]，用'?'代替以便对比 / The recursive version lacks [...], so use '?' instead
+        const char *naive_pattern = p == 2 ? "*utils*.?" : patterns[p];
+
+        size_t hits = 0;
+        double start = bench_now();
+        for (size_t i = 0; i < count; i++) {
+            hits += (size_t)naive_match(naive_pattern, storage + i * 48);
+        }
+        double t_naive = bench_now() - start;
+
+        size_t hits_glob = 0;
+        start = bench_now();
+        for (size_t i = 0; i < count; i++) {
+            hits_glob += glob_match(glob, storage + i * 48);
+        }
+        double t_glob = bench_now() - start;
+        bench_consume(hits + hits_glob);
+
+        printf("  %-14s | %8zu | %12.1f | %12.1f | %6.1fx\n", patterns[p], hits_glob,
+               t_naive * 1e9 / count, t_glob * 1e9 / count, t_glob > 0 ? t_naive / t_glob : 0.0);
+        glob_free(glob);
+    }
+    free(storage);
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 100000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 100000;
+        }
+    }
+
+    bench_print_title("通配符匹配 / Glob Matching");
+    bench_pathological();
+    bench_paths(count);
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * 哈希函数基准测试 / Hash Function Benchmark
+ *
+ * 按输入大小测量 hash64、hash_crc32c（硬件优先）和 hash_crc32c_sw 的吞吐量
+ * Measures throughput of hash64, hash_crc32c (hardware when available) and
+ * hash_crc32c_sw per input size
+ *
+ * 用法 / Usage:
+ *   ./bench_hash [每项测量的MB数 / MB per measurement, default 32]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "hash.h"
+#include "bench.h"
+
+// 被测函数的统一签名 / Common signature for the functions under test
+typedef uint64_t (*hash_fn_t)(const void *data, size_t len);
+
+static uint64_t run_hash64(const void *data, size_t len) {
+    return hash64(data, len, HASH_DEFAULT_SEED);
+}
+
+static uint64_t run_crc32c(const void *data, size_t len) {
+    return hash_crc32c(0, data, len);
+}
+
+static uint64_t run_crc32c_sw(const void *data, size_t len) {
+    return hash_crc32c_sw(0, data, len);
+}
+
+// 测量一种函数在一种大小上的吞吐量（GB/s）/ Measure one function at one size (GB/s)
+static double measure(hash_fn_t fn, const unsigned char *buf, size_t size, size_t total_bytes,
+                      double *ns_per_call) {
+    size_t iterations = total_bytes / size;
+    if (iterations == 0) {
+        iterations = 1;
+    }
+    uint64_t acc = 0;
+    double start = bench_now();
+    for (size_t i = 0; i < iterations; i++) {
+        // 偏移随迭代变化，避免只测到同一缓存行 / Vary the offset so we do not time a single cache line
+        acc += fn(buf + (i & 7), size);
+    }
+    double elapsed = bench_now() - start;
+    bench_consume(acc);
+    *ns_per_call = elapsed * 1e9 / (double)iterations;
+    return elapsed > 0 ? (double)iterations * (double)size / elapsed / 1e9 : 0.0;
+}
+
+int main(int argc, char *argv[]) {
+    size_t total_mb = 32;
+    if (argc > 1) {
+        total_mb = (size_t)strtoul(argv[1], NULL, 10);
+        if (total_mb == 0) {
+            total_mb = 32;
+        }
+    }
+    size_t total_bytes = total_mb << 20;
+
+    static const size_t sizes[] = {
+        4, 8, 16, 32, 64, 128, 256, 1024, 4096, 65536, 1 << 20
+    };
+    const size_t max_size = 1 << 20;
+
+    unsigned char *buf = malloc(max_size + 8);
+    if (buf == NULL) {
+        fprintf(stderr, "内存分配失败 / Memory allocation failed\n");
+        return 1;
+    }
+    for (size_t i = 0; i < max_size + 8; i++) {
+        buf[i] = (unsigned char)(i * 131 + 7);
+    }
+
+    bench_print_title("哈希吞吐量 / Hash Throughput");
+    printf("  硬件CRC32C / Hardware CRC32C: %s\n",
+           hash_crc32c_hw_available() ? "SSE4.2 crc32" : "不可用 / unavailable");
+    printf("  每项数据量 / Bytes per measurement: %zu MB\n\n", total_mb);
+    printf("  %8s | %18s | %18s | %18s\n", "size", "hash64", "hash_crc32c", "hash_crc32c_sw");
+    printf("  %8s | %18s | %18s | %18s\n", "(bytes)", "GB/s (ns/call)", "GB/s (ns/call)",
+           "GB/s (ns/call)");
+    printf("  ---------+--------------------+--------------------+-------------------\n");
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        double ns_h, ns_c, ns_s;
+        double gb_h = measure(run_hash64, buf, sizes[i], total_bytes, &ns_h);
+        double gb_c = measure(run_crc32c, buf, sizes[i], total_bytes, &ns_c);
+        double gb_s = measure(run_crc32c_sw, buf, sizes[i], total_bytes, &ns_s);
+        printf("  %8zu | %7.2f (%8.1f) | %7.2f (%8.1f) | %7.2f (%8.1f)\n",
+               sizes[i], gb_h, ns_h, gb_c, ns_c, gb_s, ns_s);
+    }
+
+    free(buf);
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * 忽略大小写比较与哈希基准测试 / Case-Insensitive Compare and Hash Benchmark
+ *
+ * 按键长度对比：
+ *   - 相等比较：memcmp、str_ieq_n、逐字节tolower
+ *   - 哈希：hash64、str_ihash
+ * Per key length, compares:
+ *   - equality: memcmp, str_ieq_n, a byte-wise tolower loop
+ *   - hashing: hash64, str_ihash
+ *
+ * 用法 / Usage:
+ *   ./bench_icase [每项调用次数（百万）/ millions of calls per measurement, default 4]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "string_utils.h"
+#include "hash.h"
+#include "bench.h"
+
+// 键的最大长度 / Maximum key length
+#define MAX_KEY 256
+
+// 偏移的个数，让每次调用读到不同的数据 / Number of offsets, so calls read different data
+#define OFFSETS 8
+
+// 常见写法：每个字节调用一次tolower / The usual way: one tolower call per byte
+static bool tolower_eq(const char *a, const char *b, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (tolower((unsigned char)a[i]) != tolower((unsigned char)b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    size_t millions = 4;
+    if (argc > 1) {
+        millions = (size_t)strtoul(argv[1], NULL, 10);
+        if (millions == 0) {
+            millions = 4;
+        }
+    }
+    const size_t calls = millions * 1000000;
+
+    // a是混合大小写的名字，b是它的大写形式 / a is a mixed-case name, b its uppercase form
+    char a[MAX_KEY + OFFSETS], b[MAX_KEY + OFFSETS];
+    static const char name[] = "Zhang San Li Si Wang Wu ";
+    for (size_t i = 0; i < sizeof(a); i++) {
+        a[i] = name[i % (sizeof(name) - 1)];
+        b[i] = (char)toupper((unsigned char)a[i]);
+    }
+
+    static const size_t sizes[] = { 4, 8, 12, 16, 24, 32, 64, 256 };
+
+    bench_print_title("忽略大小写比较与哈希 / Case-Insensitive Compare and Hash");
+    printf("  每项 / Per measurement: %zu M calls, ns/call\n\n", millions);
+    printf("  %5s | %8s | %10s | %10s | %8s | %9s\n",
+           "bytes", "memcmp", "str_ieq_n", "tolower", "hash64", "str_ihash");
+    printf("  ------+----------+------------+------------+----------+----------\n");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+        size_t iterations = calls * 16 / (n + 16);
+        double t[5];
+        uint64_t acc = 0;
+
+        double start = bench_now();
+        for (size_t i = 0; i < iterations; i++) {
+            size_t off = i % OFFSETS;
+            // 大小写相同的副本做memcmp / memcmp compares same-case copies
+            acc += memcmp(a + off, a + (OFFSETS - 1 - off), n) == 0;
+        }
+        t[0] = bench_now() - start;
+
+        start = bench_now();
+        for (size_t i = 0; i < iterations; i++) {
+            size_t off = i % OFFSETS;
+            acc += str_ieq_n(a + off, b + off, n);
+        }
+        t[1] = bench_now() - start;
+
+        start = bench_now();
+        for (size_t i = 0; i < iterations; i++) {
+            size_t off = i % OFFSETS;
+            acc += tolower_eq(a + off, b + off, n);
+        }
+        t[2] = bench_now() - start;
+
+        start = bench_now();
+        for (size_t i = 0; i < iterations; i++) {
+            acc += hash64(a + i % OFFSETS, n, HASH_DEFAULT_SEED);
+        }
+        t[3] = bench_now() - start;
+
+        start = bench_now();
+        for (size_t i = 0; i < iterations; i++) {
+            acc += str_ihash(b + i % OFFSETS, n);
+        }
+        t[4] = bench_now() - start;
+        bench_consume(acc);
+
+        printf("  %5zu | %8.2f | %10.2f | %10.2f | %8.2f | %9.2f\n", n,
+               t[0] * 1e9 / iterations, t[1] * 1e9 / iterations, t[2] * 1e9 / iterations,
+               t[3] * 1e9 / iterations, t[4] * 1e9 / iterations);
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+/**
+ * 字符串驻留基准测试 / String Interning Benchmark
+ *
+ * 模拟加载图书目录：每条记录有书名和作者，作者大量重复。
+ *   - strdup：像createBook一样每条记录malloc+strcpy书名和作者
+ *   - intern_str：逐个驻留
+ *   - intern_bulk：整批驻留（先算哈希，再预取槽）
+ * Simulates loading a book catalog: each record has a title and an author, and authors repeat a lot.
+ *   - strdup: malloc + strcpy of title and author per record, like createBook
+ *   - intern_str: intern one by one
+ *   - intern_bulk: intern the whole batch (hash first, then prefetch slots)
+ *
+ * 用法 / Usage:
+ *   ./bench_intern [记录数 / number of records, default 200000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "str_intern.h"
+#include "bench.h"
+
+// 不同作者数和不同书名数 / Distinct authors and distinct titles
+#define NUM_AUTHORS 2000
+#define NUM_TITLES 50000
+
+// 生成确定性的名字 / Generate a deterministic name
+static char* make_name(const char *prefix, size_t id) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%s %zu-%zx", prefix, id, id * 2654435761u);
+    size_t len = strlen(buf);
+    char *s = malloc(len + 1);
+    if (s != NULL) {
+        memcpy(s, buf, len + 1);
+    }
+    return s;
+}
+
+static char* dup_string(const char *s) {
+    size_t len = strlen(s);
+    char *copy = malloc(len + 1);
+    if (copy != NULL) {
+        memcpy(copy, s, len + 1);
+    }
+    return copy;
+}
+
+int main(int argc, char *argv[]) {
+    size_t records = 200000;
+    if (argc > 1) {
+        records = (size_t)strtoul(argv[1], NULL, 10);
+        if (records == 0) {
+            records = 200000;
+        }
+    }
+
+    char **authors = malloc(NUM_AUTHORS * sizeof(char *));
+    char **titles = malloc(NUM_TITLES * sizeof(char *));
+    const char **input = malloc(records * 2 * sizeof(char *));
+    const char **output = malloc(records * 2 * sizeof(char *));
+    char **copies = malloc(records * 2 * sizeof(char *));
+    if (authors == NULL || titles == NULL || input == NULL || output == NULL || copies == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < NUM_AUTHORS; i++) {
+        authors[i] = make_name("Author", i);
+    }
+    for (size_t i = 0; i < NUM_TITLES; i++) {
+        titles[i] = make_name("A Book About Topic", i);
+    }
+    // 每条记录：书名，作者 / Each record: title, author
+    uint64_t state = 88172645463325252ull;
+    size_t string_bytes = 0;
+    for (size_t r = 0; r < records; r++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        input[2 * r] = titles[state % NUM_TITLES];
+        input[2 * r + 1] = authors[(state >> 32) % NUM_AUTHORS];
+        string_bytes += strlen(input[2 * r]) + strlen(input[2 * r + 1]) + 2;
+    }
+    size_t n = records * 2;
+
+    bench_print_title("字符串驻留 / String Interning");
+    printf("  %zu 条记录，%d 个作者，%d 个书名 / %zu records, %d authors, %d titles\n\n",
+           records, NUM_AUTHORS, NUM_TITLES, records, NUM_AUTHORS, NUM_TITLES);
+
+    // strdup每条记录 / strdup per record
+    uint64_t acc = 0;
+    double start = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        copies[i] = dup_string(input[i]);
+        acc += copies[i] != NULL ? (unsigned char)copies[i][0] : 0;
+    }
+    double t_strdup = bench_now() - start;
+    for (size_t i = 0; i < n; i++) {
+        free(copies[i]);
+    }
+
+    // 逐个驻留 / Intern one by one
+    intern_pool_t pool;
+    intern_init(&pool);
+    start = bench_now();
+    for (size_t i = 0; i < n; i++) {
+        output[i] = intern_str(&pool, input[i]);
+        acc += (uintptr_t)output[i];
+    }
+    double t_intern = bench_now() - start;
+    intern_free(&pool);
+
+    // 批量驻留 / Bulk interning
+    intern_init(&pool);
+    start = bench_now();
+    size_t done = intern_bulk(&pool, input, NULL, n, output);
+    for (size_t i = 0; i < done; i++) {
+        acc += (uintptr_t)output[i];
+    }
+    double t_bulk = bench_now() - start;
+    bench_consume(acc);
+
+    intern_stats_t stats;
+    intern_get_stats(&pool, &stats);
+    intern_free(&pool);
+
+    double per_record = 1e9 / (double)records;
+    printf("  %-14s | %11s | %8s\n", "method", "ns/record", "speedup");
+    printf("  ---------------+-------------+---------\n");
+    printf("  %-14s | %11.1f | %7.2fx\n", "strdup", t_strdup * per_record, 1.0);
+    printf("  %-14s | %11.1f | %7.2fx\n", "intern_str", t_intern * per_record,
+           t_intern > 0 ? t_strdup / t_intern : 0.0);
+    printf("  %-14s | %11.1f | %7.2fx\n", "intern_bulk", t_bulk * per_record,
+           t_bulk > 0 ? t_strdup / t_bulk : 0.0);
+
+    // strdup的字节数不含malloc每块的头部开销 / strdup bytes exclude malloc's per-chunk overhead
+    printf("\n  strdup 字符串字节 / string bytes:  %zu\n", string_bytes);
+    printf("  驻留字符串字节 / interned bytes:   %zu (节省 / saved %zu)\n",
+           stats.bytes_stored, stats.bytes_saved);
+    printf("  驻留总占用 / interning footprint: %zu (区域 + 哈希表 / arena + table)\n",
+           stats.memory_used);
+
+    for (size_t i = 0; i < NUM_AUTHORS; i++) {
+        free(authors[i]);
+    }
+    for (size_t i = 0; i < NUM_TITLES; i++) {
+        free(titles[i]);
+    }
+    free(authors);
+    free(titles);
+    free(input);
+    free(output);
+    free(copies);
+    return 0;
+}
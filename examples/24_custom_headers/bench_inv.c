@@ -0,0 +1,210 @@
+/**
+ * 倒排索引基准测试 / Inverted Index Benchmark
+ *
+ * 在生成的语料（每行一个文档）上输出 / On a generated corpus (one document per line) reports:
+ *   - 建立索引的耗时和索引大小 / Index build time and index size
+ *   - 不同词频组合的AND查询延迟 / AND query latency for different term frequency mixes
+ *   - inv_intersect与普通归并的对比 / inv_intersect against a plain merge
+ *
+ * 用法 / Usage:
+ *   ./bench_inv [语料字节数 / corpus bytes, default 8000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "inv_index.h"
+#include "bench.h"
+
+// 词汇量 / Vocabulary size
+#define VOCABULARY 20000
+
+// 每种查询的重复次数 / Repetitions per query kind
+#define QUERY_REPEAT 50
+
+static uint64_t rng_state = 88172645463325252ull;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+// 第i个词：w加上编号，编号越小越常见 / The i-th word: "w" plus its number; smaller numbers are more common
+static int word_at(size_t i, char *buf) {
+    return sprintf(buf, "w%zu", i);
+}
+
+// 生成近似Zipf分布的语料，每行约10个词 / Generate a roughly Zipf-distributed corpus, about 10 words a line
+static char* generate_corpus(size_t size) {
+    char *text = malloc(size);
+    if (text == NULL) {
+        return NULL;
+    }
+    size_t pos = 0;
+    while (pos + 16 < size) {
+        uint64_t r = next_random();
+        double u = (double)(r >> 11) / 9007199254740992.0;
+        pos += (size_t)word_at((size_t)(u * u * u * VOCABULARY), text + pos);
+        text[pos++] = (r & 0xF) < 2 ? '\n' : ' ';
+    }
+    memset(text + pos, ' ', size - pos);
+    return text;
+}
+
+// 普通归并，作为对照 / Plain merge, for comparison
+static size_t merge_intersect(const uint32_t *a, size_t na, const uint32_t *b, size_t nb, uint32_t *out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (a[i] > b[j]) {
+            j++;
+        } else {
+            out[k++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    return k;
+}
+
+// 测量一种AND查询 / Time one kind of AND query
+static void time_query(const inv_index_t *index, const char *label, size_t w1, size_t w2, size_t w3,
+                       uint32_t *out) {
+    char names[3][24];
+    const char *terms[3] = { names[0], names[1], names[2] };
+    word_at(w1, names[0]);
+    word_at(w2, names[1]);
+    size_t num_terms = 2;
+    if (w3 != SIZE_MAX) {
+        word_at(w3, names[2]);
+        num_terms = 3;
+    }
+    size_t matches = 0;
+    double start = bench_now();
+    for (int r = 0; r < QUERY_REPEAT; r++) {
+        matches = inv_index_and(index, terms, num_terms, out, index->num_docs);
+        bench_consume(matches);
+    }
+    double elapsed = (bench_now() - start) / QUERY_REPEAT;
+    char freqs[48];
+    if (num_terms == 2) {
+        snprintf(freqs, sizeof(freqs), "%u & %u",
+                 inv_index_doc_freq(index, names[0], strlen(names[0])),
+                 inv_index_doc_freq(index, names[1], strlen(names[1])));
+    } else {
+        snprintf(freqs, sizeof(freqs), "%u & %u & %u",
+                 inv_index_doc_freq(index, names[0], strlen(names[0])),
+                 inv_index_doc_freq(index, names[1], strlen(names[1])),
+                 inv_index_doc_freq(index, names[2], strlen(names[2])));
+    }
+    printf("  %-22s | %-24s | %9zu | %10.1f\n", label, freqs, matches, elapsed * 1e6);
+}
+
+// 随机递增数组，平均间隔为gap / Random increasing array with an average gap of gap
+static void fill_sorted(uint32_t *a, size_t n, uint32_t gap) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < n; i++) {
+        value += 1 + (uint32_t)(next_random() % (2 * gap - 1));
+        a[i] = value;
+    }
+}
+
+// 比较两种交集算法 / Compare the two intersection algorithms
+static void time_intersect(const char *label, size_t na, uint32_t gap_a, size_t nb, uint32_t gap_b) {
+    uint32_t *a = malloc(na * sizeof(uint32_t));
+    uint32_t *b = malloc(nb * sizeof(uint32_t));
+    uint32_t *out = malloc((na < nb ? na : nb) * sizeof(uint32_t));
+    if (a == NULL || b == NULL || out == NULL) {
+        free(a);
+        free(b);
+        free(out);
+        return;
+    }
+    fill_sorted(a, na, gap_a);
+    fill_sorted(b, nb, gap_b);
+
+    size_t k_merge = 0, k_inv = 0;
+    double start = bench_now();
+    for (int r = 0; r < QUERY_REPEAT; r++) {
+        k_merge = merge_intersect(a, na, b, nb, out);
+        bench_consume(out[k_merge / 2]);
+    }
+    double t_merge = (bench_now() - start) / QUERY_REPEAT;
+    start = bench_now();
+    for (int r = 0; r < QUERY_REPEAT; r++) {
+        k_inv = inv_intersect(a, na, b, nb, out);
+        bench_consume(out[k_inv / 2]);
+    }
+    double t_inv = (bench_now() - start) / QUERY_REPEAT;
+    printf("  %-22s | %10.1f | %13.1f | %6.2fx%s\n", label, t_merge * 1e6, t_inv * 1e6,
+           t_inv > 0 ? t_merge / t_inv : 0.0, k_merge == k_inv ? "" : "  (结果错误 / WRONG)");
+    free(a);
+    free(b);
+    free(out);
+}
+
+int main(int argc, char *argv[]) {
+    size_t size = 8000000;
+    if (argc > 1) {
+        size = (size_t)strtoul(argv[1], NULL, 10);
+        if (size < 1000) {
+            size = 8000000;
+        }
+    }
+    char *text = generate_corpus(size);
+    if (text == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+
+    bench_print_title("倒排索引 / Inverted Index");
+
+    inv_index_t index;
+    double start = bench_now();
+    if (!inv_index_build(&index, text, size)) {
+        fprintf(stderr, "建立失败 / Build failed\n");
+        free(text);
+        return 1;
+    }
+    double t_build = bench_now() - start;
+    size_t plain_bytes = 0;
+    for (size_t t = 0; t < index.num_terms; t++) {
+        plain_bytes += index.doc_freqs[t] * sizeof(uint32_t);
+    }
+    printf("  语料 / Corpus: %.1f MB, %u 行 / lines, %zu 个词 / terms\n",
+           (double)size / 1e6, index.num_docs, index.num_terms);
+    printf("  建立 / Build: %.1f ms (%.0f MB/s)\n", t_build * 1e3, (double)size / t_build / 1e6);
+    printf("  列表 / Postings: %zu 字节变长编码 / bytes as varints, %zu 字节uint32 / bytes as uint32 (%.1fx)\n",
+           index.postings_size, plain_bytes, (double)plain_bytes / (double)index.postings_size);
+    printf("  索引总计 / Index total: %zu 字节 / bytes\n\n", inv_index_memory(&index));
+
+    uint32_t *out = malloc((index.num_docs > 0 ? index.num_docs : 1) * sizeof(uint32_t));
+    if (out == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        inv_index_free(&index);
+        free(text);
+        return 1;
+    }
+    printf("  %-22s | %-24s | %9s | %10s\n", "AND query", "doc freqs", "matches", "us/query");
+    printf("  -----------------------+--------------------------+-----------+-----------\n");
+    time_query(&index, "common & common", 0, 1, SIZE_MAX, out);
+    time_query(&index, "common & mid", 0, 200, SIZE_MAX, out);
+    time_query(&index, "common & rare", 1, 5000, SIZE_MAX, out);
+    time_query(&index, "mid & mid", 100, 150, SIZE_MAX, out);
+    time_query(&index, "common & common & mid", 0, 2, 50, out);
+    free(out);
+
+    printf("\n  %-22s | %10s | %13s | %7s\n", "intersect (sizes)", "merge us", "inv_intersect", "speedup");
+    printf("  -----------------------+------------+---------------+--------\n");
+    time_intersect("100K & 100K", 100000, 4, 100000, 4);
+    time_intersect("100K & 30K", 100000, 4, 30000, 13);
+    time_intersect("1M & 10K (gallop)", 1000000, 4, 10000, 400);
+    time_intersect("1M & 100 (gallop)", 1000000, 4, 100, 40000);
+
+    inv_index_free(&index);
+    free(text);
+    return 0;
+}
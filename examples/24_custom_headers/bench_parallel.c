@@ -0,0 +1,84 @@
+/**
+ * 并行归约基准测试 / Parallel Reduction Benchmark
+ *
+ * 对1、2、4……N个线程测量utils_array_sum_parallel/max/min的耗时和加速比
+ * Measures utils_array_sum_parallel/max/min and their speedup for 1, 2, 4, ... N threads
+ *
+ * 用法 / Usage:
+ *   ./bench_parallel [元素个数 / number of elements, default 32000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils.h"
+#include "bench.h"
+
+// 重复次数 / Repetitions
+#define REPEAT 5
+
+int main(int argc, char *argv[]) {
+    size_t count = 32000000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 32000000;
+        }
+    }
+    int *arr = malloc(count * sizeof(int));
+    if (arr == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < count; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        arr[i] = (int)state;
+    }
+
+    bench_print_title("并行归约 / Parallel Reductions");
+    int cores = utils_cpu_count();
+    printf("  %zu 个int / ints (%.1f MB), %d 个核 / cores\n\n",
+           count, (double)(count * sizeof(int)) / 1e6, cores);
+    printf("  %-8s | %10s | %10s | %10s | %10s | %8s\n", "threads", "sum ms", "max ms", "min ms", "sum GB/s",
+           "speedup");
+    printf("  ---------+------------+------------+------------+------------+---------\n");
+
+    long long expected = utils_array_sum_parallel(arr, count, 1);
+    double t_single = 0;
+    for (int threads = 1; threads <= cores; threads = bench_next_threads(threads, cores)) {
+        long long sum = 0;
+        int extreme = 0;
+        double start = bench_now();
+        for (int r = 0; r < REPEAT; r++) {
+            sum = utils_array_sum_parallel(arr, count, threads);
+            bench_consume((uint64_t)sum);
+        }
+        double t_sum = (bench_now() - start) / REPEAT;
+        start = bench_now();
+        for (int r = 0; r < REPEAT; r++) {
+            utils_array_max_parallel(arr, count, threads, &extreme);
+            bench_consume((uint64_t)extreme);
+        }
+        double t_max = (bench_now() - start) / REPEAT;
+        start = bench_now();
+        for (int r = 0; r < REPEAT; r++) {
+            utils_array_min_parallel(arr, count, threads, &extreme);
+            bench_consume((uint64_t)extreme);
+        }
+        double t_min = (bench_now() - start) / REPEAT;
+
+        if (threads == 1) {
+            t_single = t_sum;
+        }
+        printf("  %-8d | %10.2f | %10.2f | %10.2f | %10.2f | %7.2fx%s\n", threads, t_sum * 1e3,
+               t_max * 1e3, t_min * 1e3, (double)(count * sizeof(int)) / t_sum / 1e9,
+               t_sum > 0 ? t_single / t_sum : 0.0, sum == expected ? "" : "  (结果不一致 / MISMATCH)");
+    }
+    printf("\n  少于 %d 个元素时不建线程 / No threads are started below %d elements\n",
+           2 * UTILS_PARALLEL_MIN_CHUNK, 2 * UTILS_PARALLEL_MIN_CHUNK);
+
+    free(arr);
+    return 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * 数值解析基准测试 / Number Parsing Benchmark
+ *
+ * 模拟读取成绩文件：每行一个用空格分隔的字段，分两组输入：
+ *   - 成绩：一两位小数（"85.5"、"92.25"），和06_file_operations里的Student成绩一样
+ *   - 全精度：随机double按"%.17g"输出，走Eisel-Lemire路径
+ * 对比 str_parse_double、strtod 和 fscanf("%lf")（从临时文件读）
+ * Simulates reading score files, one space-separated field after another, with two inputs:
+ *   - scores: one or two decimals ("85.5", "92.25"), like the Student scores in 06_file_operations
+ *   - full precision: random doubles printed with "%.17g", which take the Eisel-Lemire path
+ * Compares str_parse_double, strtod and fscanf("%lf") (reading from a temporary file)
+ *
+ * 用法 / Usage:
+ *   ./bench_parse [字段数 / number of fields, default 1000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "str_parse.h"
+#include "bench.h"
+
+// 生成一组字段，返回文本长度 / Generate one set of fields, returning the text length
+static size_t make_fields(char *text, size_t fields, int full_precision) {
+    uint64_t x = 0x9E3779B97F4A7C15ull;
+    size_t len = 0;
+    for (size_t i = 0; i < fields; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        if (full_precision) {
+            double value = (double)(x >> 11) * 0x1.0p-53 * 1e6;
+            len += (size_t)sprintf(text + len, "%.17g ", value);
+        } else if (x & 1) {
+            len += (size_t)sprintf(text + len, "%u.%u ", (unsigned)(x >> 8) % 101, (unsigned)(x >> 20) % 10);
+        } else {
+            len += (size_t)sprintf(text + len, "%u.%02u ", (unsigned)(x >> 8) % 101,
+                                   (unsigned)(x >> 20) % 100);
+        }
+    }
+    text[len] = '\0';
+    return len;
+}
+
+// 测量一组输入 / Measure one input set
+static int run_set(const char *name, char *text, size_t len, size_t fields, double *values) {
+    uint64_t acc = 0;
+    int ok = 1;
+
+    // str_parse_double：按长度，返回数字之后的位置 / By length, returning the position after the number
+    double start = bench_now();
+    const char *p = text;
+    const char *end = text + len;
+    for (size_t i = 0; i < fields; i++) {
+        p = str_parse_double(p, (size_t)(end - p), &values[i]);
+        if (p == NULL) {
+            ok = 0;
+            break;
+        }
+        p++;  // 跳过空格 / Skip the space
+    }
+    double t_parse = bench_now() - start;
+
+    // strtod：需要'\0'结尾，受区域设置影响 / Needs a '\0' terminator and depends on the locale
+    start = bench_now();
+    char *q = text;
+    for (size_t i = 0; i < fields; i++) {
+        double value = strtod(q, &q);
+        ok &= value == values[i];
+        acc += (uint64_t)value;
+    }
+    double t_strtod = bench_now() - start;
+
+    // fscanf("%lf")：06_file_operations读成绩的方式 / How 06_file_operations reads scores
+    double t_fscanf = 0.0;
+    FILE *file = tmpfile();
+    if (file != NULL && fwrite(text, 1, len, file) == len) {
+        rewind(file);
+        start = bench_now();
+        for (size_t i = 0; i < fields; i++) {
+            double value;
+            if (fscanf(file, "%lf", &value) != 1) {
+                ok = 0;
+                break;
+            }
+            ok &= value == values[i];
+            acc += (uint64_t)value;
+        }
+        t_fscanf = bench_now() - start;
+    }
+    if (file != NULL) {
+        fclose(file);
+    }
+    bench_consume(acc);
+
+    double per_field = 1e9 / (double)fields;
+    double mb = (double)len / 1e6;
+    printf("\n  [%s] %zu 个字段 / fields, %.1f MB\n", name, fields, mb);
+    printf("  %-18s | %10s | %9s | %8s\n", "method", "ns/field", "MB/s", "speedup");
+    printf("  -------------------+------------+-----------+---------\n");
+    printf("  %-18s | %10.1f | %9.0f | %7.2fx\n", "fscanf(\"%lf\")", t_fscanf * per_field,
+           t_fscanf > 0 ? mb / t_fscanf : 0.0, 1.0);
+    printf("  %-18s | %10.1f | %9.0f | %7.2fx\n", "strtod", t_strtod * per_field,
+           t_strtod > 0 ? mb / t_strtod : 0.0, t_strtod > 0 ? t_fscanf / t_strtod : 0.0);
+    printf("  %-18s | %10.1f | %9.0f | %7.2fx\n", "str_parse_double", t_parse * per_field,
+           t_parse > 0 ? mb / t_parse : 0.0, t_parse > 0 ? t_fscanf / t_parse : 0.0);
+    printf("  结果与strtod一致 / Results match strtod: %s\n", ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    size_t fields = 1000000;
+    if (argc > 1) {
+        fields = (size_t)strtoul(argv[1], NULL, 10);
+        if (fields == 0) {
+            fields = 1000000;
+        }
+    }
+
+    // "%.17g"最多24个字符加一个空格 / "%.17g" is at most 24 characters plus a space
+    char *text = malloc(fields * 25 + 1);
+    double *values = malloc(fields * sizeof(double));
+    if (text == NULL || values == NULL) {
+        fprintf(stderr, "内存分配失败 / Memory allocation failed\n");
+        free(text);
+        free(values);
+        return 1;
+    }
+
+    bench_print_title("数值解析 / Number Parsing");
+    size_t len = make_fields(text, fields, 0);
+    int ok = run_set("成绩 / scores", text, len, fields, values);
+    len = make_fields(text, fields, 1);
+    ok &= run_set("全精度 / full precision", text, len, fields, values);
+
+    free(text);
+    free(values);
+    return ok ? 0 : 1;
+}
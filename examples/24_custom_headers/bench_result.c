@@ -0,0 +1,201 @@
+/**
+ * 返回值约定基准测试 / Return Convention Benchmark
+ *
+ * 对短数组（典型的热路径：每个小窗口、每一行）反复求最大值，对比三种返回方式：
+ *   - 返回utils_result_t（72字节，经隐藏指针复制，每次填message）
+ *   - 返回状态码，值写到输出指针（utils_array_max）
+ *   - 返回utils_value_t（8字节，一个寄存器），失败细节写进线程局部的错误上下文（utils_array_max_value）
+ * 最后测失败路径：填message与记录错误上下文
+ * Repeatedly finds the maximum of short arrays (a typical hot path: every small window, every row) with
+ * three return conventions:
+ *   - returning utils_result_t (72 bytes copied through a hidden pointer, message filled every time)
+ *   - returning a status with the value written through an out pointer (utils_array_max)
+ *   - returning utils_value_t (8 bytes, one register) with failure details written to a thread-local
+ *     error context (utils_array_max_value)
+ * and finally the failure path: filling the message versus recording the error context
+ *
+ * 用法 / Usage:
+ *   ./bench_result [调用次数 / number of calls, default 5000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils.h"
+#include "bench.h"
+
+// 重复轮数 / Rounds
+#define REPEAT 3
+
+// 每次调用的数组长度 / Array length per call
+#define WIDTH 8
+
+// 数据数组长度（2的幂）/ Length of the data array (a power of two)
+#define DATA 4096
+
+#if defined(__GNUC__)
+    #define BENCH_NOINLINE __attribute__((noinline))
+#else
+    #define BENCH_NOINLINE
+#endif
+
+// 按utils_result_t约定写的最大值，和库函数一样不能被内联 / Maximum in the utils_result_t convention, kept out
+// of line like a library function
+static BENCH_NOINLINE utils_result_t result_array_max(const int *arr, size_t size) {
+    utils_result_t result = { 0, UTILS_SUCCESS, "" };
+    if (arr == NULL || size == 0) {
+        result.status = arr == NULL ? UTILS_ERROR_NULL : UTILS_ERROR_RANGE;
+    } else {
+        result.value = arr[0];
+        for (size_t i = 1; i < size; i++) {
+            if (arr[i] > result.value) {
+                result.value = arr[i];
+            }
+        }
+    }
+    snprintf(result.message, sizeof(result.message), "%s", utils_status_message(result.status));
+    return result;
+}
+
+// 同上，但成功时不填message，只剩72字节的复制 / As above but without filling the message on success,
+// leaving only the 72-byte copy
+static BENCH_NOINLINE utils_result_t result_array_max_quiet(const int *arr, size_t size) {
+    utils_result_t result = { 0, UTILS_SUCCESS, "" };
+    if (arr == NULL || size == 0) {
+        result.status = arr == NULL ? UTILS_ERROR_NULL : UTILS_ERROR_RANGE;
+        snprintf(result.message, sizeof(result.message), "%s", utils_status_message(result.status));
+    } else {
+        result.value = arr[0];
+        for (size_t i = 1; i < size; i++) {
+            if (arr[i] > result.value) {
+                result.value = arr[i];
+            }
+        }
+    }
+    return result;
+}
+
+// 三种约定的热路径，返回校验和 / The hot path in each convention, returning a checksum
+static long long run_result(const int *data, size_t calls) {
+    long long check = 0;
+    for (size_t i = 0; i < calls; i++) {
+        utils_result_t result = result_array_max(data + (i & (DATA - 1)), WIDTH);
+        if (result.status == UTILS_SUCCESS) {
+            check += result.value;
+        }
+    }
+    return check;
+}
+
+static long long run_result_quiet(const int *data, size_t calls) {
+    long long check = 0;
+    for (size_t i = 0; i < calls; i++) {
+        utils_result_t result = result_array_max_quiet(data + (i & (DATA - 1)), WIDTH);
+        if (result.status == UTILS_SUCCESS) {
+            check += result.value;
+        }
+    }
+    return check;
+}
+
+static long long run_pointer(const int *data, size_t calls) {
+    long long check = 0;
+    for (size_t i = 0; i < calls; i++) {
+        int value;
+        if (utils_array_max(data + (i & (DATA - 1)), WIDTH, &value) == UTILS_SUCCESS) {
+            check += value;
+        }
+    }
+    return check;
+}
+
+static long long run_value(const int *data, size_t calls) {
+    long long check = 0;
+    for (size_t i = 0; i < calls; i++) {
+        utils_value_t result = utils_array_max_value(data + (i & (DATA - 1)), WIDTH);
+        if (result.status == UTILS_SUCCESS) {
+            check += result.value;
+        }
+    }
+    return check;
+}
+
+// 失败路径：空数组 / Failure path: empty arrays
+static long long run_result_failure(const int *data, size_t calls) {
+    long long check = 0;
+    for (size_t i = 0; i < calls; i++) {
+        check += result_array_max(data, 0).status;
+    }
+    return check;
+}
+
+static long long run_value_failure(const int *data, size_t calls) {
+    long long check = 0;
+    for (size_t i = 0; i < calls; i++) {
+        check += utils_array_max_value(data, 0).status;
+    }
+    return check;
+}
+
+static void print_row(const char *name, double seconds, size_t calls, double baseline, long long check) {
+    printf("  %-38s | %8.2f | %8.2f | %7.2fx | %lld\n", name, seconds * 1e3, seconds * 1e9 / (double)calls,
+           seconds > 0 ? baseline / seconds : 0.0, check);
+}
+
+int main(int argc, char *argv[]) {
+    size_t calls = 5000000;
+    if (argc > 1) {
+        calls = (size_t)strtoul(argv[1], NULL, 10);
+        if (calls == 0) {
+            calls = 5000000;
+        }
+    }
+    static int data[DATA + WIDTH];
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < DATA + WIDTH; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        data[i] = (int)(state % 1000000);
+    }
+
+    bench_print_title("返回值约定 / Return Conventions");
+    printf("  %zu 次调用 / calls, 每次 / each on %d 个int / ints; sizeof(utils_result_t) = %zu, "
+           "sizeof(utils_value_t) = %zu\n\n", calls, WIDTH, sizeof(utils_result_t), sizeof(utils_value_t));
+    printf("  %-38s | %8s | %8s | %8s | %s\n", "convention", "ms", "ns/call", "speedup", "checksum");
+    printf("  ---------------------------------------+----------+----------+----------+-----------\n");
+
+    // 各方法交替运行REPEAT轮，取最快的一轮，减少运行顺序的影响
+    // The methods take turns for REPEAT rounds and the fastest round counts, reducing the effect of run order
+    static const struct {
+        const char *name;
+        long long (*run)(const int *, size_t);
+        bool failure;
+    } methods[] = {
+        { "utils_result_t (72 bytes + message)", run_result, false },
+        { "utils_result_t (72 bytes, no message)", run_result_quiet, false },
+        { "status + out pointer", run_pointer, false },
+        { "utils_value_t (8 bytes, register)", run_value, false },
+        { "failure: utils_result_t message", run_result_failure, true },
+        { "failure: utils_value_t + context", run_value_failure, true },
+    };
+    enum { METHODS = sizeof(methods) / sizeof(methods[0]) };
+    double best[METHODS];
+    long long checks[METHODS];
+    size_t failures = calls / 10;
+    for (int r = 0; r < REPEAT; r++) {
+        for (size_t m = 0; m < METHODS; m++) {
+            double start = bench_now();
+            checks[m] = methods[m].run(data, methods[m].failure ? failures : calls);
+            double t = bench_now() - start;
+            if (r == 0 || t < best[m]) {
+                best[m] = t;
+            }
+        }
+    }
+    for (size_t m = 0; m < METHODS; m++) {
+        double baseline = methods[m].failure ? best[4] : best[0];
+        print_row(methods[m].name, best[m], methods[m].failure ? failures : calls, baseline, checks[m]);
+    }
+    printf("\n  utils_last_error_message() = %s\n", utils_last_error_message());
+    return 0;
+}
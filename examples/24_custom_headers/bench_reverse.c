@@ -0,0 +1,102 @@
+/**
+ * 数组反转与循环移位基准测试 / Array Reverse and Rotate Benchmark
+ *
+ * 对比逐个交换的标量循环与utils_array_reverse，以及用标量反转实现的三次反转与utils_array_rotate
+ * Compares a scalar swap loop with utils_array_reverse, and three reversals built on the scalar loop
+ * with utils_array_rotate
+ *
+ * 用法 / Usage:
+ *   ./bench_reverse [元素个数 / number of elements, default 16000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils.h"
+#include "bench.h"
+
+// 重复次数 / Repetitions
+#define REPEAT 5
+
+// 原来的逐个交换 / The original one-at-a-time swap
+static void scalar_reverse(int *arr, size_t lo, size_t hi) {
+    for (; hi - lo >= 2; lo++, hi--) {
+        int temp = arr[lo];
+        arr[lo] = arr[hi - 1];
+        arr[hi - 1] = temp;
+    }
+}
+
+static void scalar_rotate(int *arr, size_t size, size_t shift) {
+    shift %= size;
+    scalar_reverse(arr, 0, shift);
+    scalar_reverse(arr, shift, size);
+    scalar_reverse(arr, 0, size);
+}
+
+static void print_row(const char *name, double t_scalar, double t_utils, size_t count) {
+    printf("  %-24s | %10.2f | %10.2f | %9.2f | %7.2fx\n", name, t_scalar * 1e3, t_utils * 1e3,
+           (double)(count * sizeof(int)) / t_utils / 1e9, t_utils > 0 ? t_scalar / t_utils : 0.0);
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 16000000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 16000000;
+        }
+    }
+    int *arr = malloc(count * sizeof(int));
+    if (arr == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        arr[i] = (int)i;
+    }
+
+    bench_print_title("数组反转与循环移位 / Array Reverse and Rotate");
+    printf("  %zu 个int / ints (%.1f MB)\n\n", count, (double)(count * sizeof(int)) / 1e6);
+    printf("  %-24s | %10s | %10s | %9s | %8s\n", "operation", "scalar ms", "utils ms", "GB/s", "speedup");
+    printf("  -------------------------+------------+------------+-----------+---------\n");
+
+    double start = bench_now();
+    for (int r = 0; r < REPEAT; r++) {
+        scalar_reverse(arr, 0, count);
+    }
+    double t_scalar = (bench_now() - start) / REPEAT;
+    start = bench_now();
+    for (int r = 0; r < REPEAT; r++) {
+        utils_array_reverse(arr, count);
+    }
+    double t_utils = (bench_now() - start) / REPEAT;
+    print_row("reverse", t_scalar, t_utils, count);
+
+    // 两种反转各做了REPEAT次，数组回到原样 / Both reversals ran REPEAT times, so the array is back in order
+    const size_t shifts[] = { 1, UTILS_ROTATE_BUFFER, count / 3 };
+    for (size_t s = 0; s < sizeof(shifts) / sizeof(shifts[0]); s++) {
+        start = bench_now();
+        for (int r = 0; r < REPEAT; r++) {
+            scalar_rotate(arr, count, shifts[s]);
+        }
+        t_scalar = (bench_now() - start) / REPEAT;
+        start = bench_now();
+        for (int r = 0; r < REPEAT; r++) {
+            utils_array_rotate(arr, count, count - shifts[s] % count);   // 右移，抵消上面的左移 / Right, undoing the left rotations above
+        }
+        t_utils = (bench_now() - start) / REPEAT;
+        char name[32];
+        snprintf(name, sizeof(name), "rotate by %zu", shifts[s]);
+        print_row(name, t_scalar, t_utils, count);
+    }
+
+    // 检查结果 / Check the result
+    bool ok = true;
+    for (size_t i = 0; i < count; i++) {
+        ok = ok && arr[i] == (int)i;
+    }
+    printf("\n  结果 / Result: %s\n", ok ? "一致 / consistent" : "不一致 / MISMATCH");
+
+    free(arr);
+    return 0;
+}
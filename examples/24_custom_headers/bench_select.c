@@ -0,0 +1,106 @@
+/**
+ * 选择与Top-k基准测试 / Selection and Top-k Benchmark
+ *
+ * 对比复制后qsort与utils_array_nth求中位数，以及复制后qsort与utils_array_topk取最大的k个，
+ * 输入分随机和升序两种（升序时堆几乎每个元素都要更新）
+ * Compares a copy + qsort with utils_array_nth for the median, and a copy + qsort with utils_array_topk
+ * for the k largest, on random and on ascending input (where the heap has to be updated for nearly every element)
+ *
+ * 用法 / Usage:
+ *   ./bench_select [元素个数 / number of elements, default 4000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils.h"
+#include "bench.h"
+
+// 重复次数 / Repetitions
+#define REPEAT 3
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static void print_row(const char *name, double t_sort, double t_utils, bool ok) {
+    printf("  %-28s | %10.2f | %10.2f | %7.2fx | %s\n", name, t_sort * 1e3, t_utils * 1e3,
+           t_utils > 0 ? t_sort / t_utils : 0.0, ok ? "ok" : "MISMATCH");
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 4000000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 4000000;
+        }
+    }
+    int *arr = malloc(count * sizeof(int));
+    int *sorted = malloc(count * sizeof(int));
+    int *work = malloc(count * sizeof(int));
+    if (arr == NULL || sorted == NULL || work == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+
+    bench_print_title("选择与Top-k / Selection and Top-k");
+    printf("  %zu 个int / ints\n\n", count);
+    printf("  %-28s | %10s | %10s | %8s | %s\n", "operation", "qsort ms", "utils ms", "speedup", "check");
+    printf("  -----------------------------+------------+------------+----------+---------\n");
+
+    uint64_t state = 88172645463325252ull;
+    for (int ascending = 0; ascending <= 1; ascending++) {
+        for (size_t i = 0; i < count; i++) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            arr[i] = ascending ? (int)i : (int)state;
+        }
+        const char *input = ascending ? "ascending" : "random";
+
+        // 中位数 / Median
+        double start = bench_now();
+        for (int r = 0; r < REPEAT; r++) {
+            memcpy(sorted, arr, count * sizeof(int));
+            qsort(sorted, count, sizeof(int), compare_int);
+            bench_consume((uint64_t)sorted[count / 2]);
+        }
+        double t_sort = (bench_now() - start) / REPEAT;
+        int median = 0;
+        start = bench_now();
+        for (int r = 0; r < REPEAT; r++) {
+            memcpy(work, arr, count * sizeof(int));
+            utils_array_nth(work, count, count / 2, &median);
+            bench_consume((uint64_t)median);
+        }
+        double t_utils = (bench_now() - start) / REPEAT;
+        char name[48];
+        snprintf(name, sizeof(name), "median, %s", input);
+        print_row(name, t_sort, t_utils, median == sorted[count / 2]);
+
+        // 最大的k个；qsort的时间与k无关，沿用上面的 / The k largest; the qsort time does not depend on k, so it is reused
+        const size_t ks[] = { 10, 1000, count / 4 };
+        for (size_t s = 0; s < sizeof(ks) / sizeof(ks[0]); s++) {
+            size_t k = ks[s] < count ? ks[s] : count;
+            start = bench_now();
+            for (int r = 0; r < REPEAT; r++) {
+                utils_array_topk(arr, count, k, work);
+                bench_consume((uint64_t)work[0]);
+            }
+            t_utils = (bench_now() - start) / REPEAT;
+            bool ok = true;
+            for (size_t i = 0; i < k; i++) {
+                ok = ok && work[i] == sorted[count - 1 - i];
+            }
+            snprintf(name, sizeof(name), "top %zu, %s", k, input);
+            print_row(name, t_sort, t_utils, ok);
+        }
+    }
+
+    free(arr);
+    free(sorted);
+    free(work);
+    return 0;
+}
@@ -0,0 +1,188 @@
+/**
+ * 字符串排序基准测试 / String Sorting Benchmark
+ *
+ * 对大量"姓, 名"形式的名字排序（大小写混杂，公共前缀很多）：
+ *   - qsort + strcmp 对比 str_sort
+ *   - qsort + 逐字符tolower比较 对比 str_sort_icase
+ * 再对公共前缀很长的字符串（一半完全相同）排序，并检查两种方法的结果一致，不一致时返回1。
+ * Sorts many "Last, First" names (mixed case, lots of shared prefixes):
+ *   - qsort + strcmp vs str_sort
+ *   - qsort + per-character tolower compare vs str_sort_icase
+ * then sorts strings with a very long shared prefix (half of them identical), and checks that both
+ * methods agree, returning 1 when they do not.
+ *
+ * 用法 / Usage:
+ *   ./bench_sort [名字数 / number of names, default 200000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "str_sort.h"
+#include "bench.h"
+
+static const char *LAST[] = {
+    "Smith", "Johnson", "Williams", "Brown", "Jones", "Garcia", "Miller", "Davis",
+    "Rodriguez", "Martinez", "Hernandez", "Lopez", "Gonzalez", "Wilson", "Anderson", "Thomas",
+    "Taylor", "Moore", "Jackson", "Martin", "Lee", "Perez", "Thompson", "White",
+    "Harris", "Sanchez", "Clark", "Ramirez", "Lewis", "Robinson", "Walker", "Young",
+};
+
+static const char *FIRST[] = {
+    "James", "Mary", "Robert", "Patricia", "John", "Jennifer", "Michael", "Linda",
+    "David", "Elizabeth", "William", "Barbara", "Richard", "Susan", "Joseph", "Jessica",
+    "Thomas", "Sarah", "Christopher", "Karen", "Charles", "Lisa", "Daniel", "Nancy",
+};
+
+#define NUM_LAST (sizeof(LAST) / sizeof(LAST[0]))
+#define NUM_FIRST (sizeof(FIRST) / sizeof(FIRST[0]))
+
+// 长前缀测试：字符串数（超过基数排序阈值）、长度和公共前缀长度
+// Long-prefix test: number of strings (above the radix threshold), length and shared prefix length
+#define LONG_COUNT 5000
+#define LONG_LENGTH 3000
+#define LONG_SHARED 2500
+
+static int compare_strcmp(const void *a, const void *b) {
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+// 常见写法：比较时逐字符tolower / The usual approach: tolower per character while comparing
+static int compare_icase(const void *a, const void *b) {
+    const unsigned char *x = *(const unsigned char *const *)a;
+    const unsigned char *y = *(const unsigned char *const *)b;
+    while (*x != 0 && tolower(*x) == tolower(*y)) {
+        x++;
+        y++;
+    }
+    return tolower(*x) - tolower(*y);
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 200000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 200000;
+        }
+    }
+
+    // 名字存放在一个大块中 / Names live in one large block
+    char *storage = malloc(count * 48);
+    const char **names = malloc(count * sizeof(char *));
+    const char **a = malloc(count * sizeof(char *));
+    const char **b = malloc(count * sizeof(char *));
+    if (storage == NULL || names == NULL || a == NULL || b == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < count; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        char *s = storage + i * 48;
+        snprintf(s, 48, "%s, %s %c. #%u", LAST[state % NUM_LAST], FIRST[(state >> 8) % NUM_FIRST],
+                 'A' + (int)((state >> 16) % 26), (unsigned)((state >> 24) % 100000));
+        if ((state >> 40) & 1) {
+            s[0] = (char)tolower((unsigned char)s[0]);   // 大小写混杂 / Mixed case
+        }
+        names[i] = s;
+    }
+
+    bench_print_title("字符串排序 / String Sorting");
+    printf("  %zu 个名字，例如 \"%s\" / %zu names, e.g. \"%s\"\n\n", count, names[0], count, names[0]);
+    printf("  %-26s | %9s | %8s\n", "method", "ms", "speedup");
+    printf("  ---------------------------+-----------+---------\n");
+
+    // 按字节序 / Byte order
+    memcpy(a, names, count * sizeof(char *));
+    double start = bench_now();
+    qsort(a, count, sizeof(char *), compare_strcmp);
+    double t_qsort = bench_now() - start;
+
+    memcpy(b, names, count * sizeof(char *));
+    start = bench_now();
+    bool ok = str_sort(b, count);
+    double t_sort = bench_now() - start;
+    for (size_t i = 0; ok && i < count; i++) {
+        ok = strcmp(a[i], b[i]) == 0;
+    }
+    bool all_ok = ok;
+    printf("  %-26s | %9.1f | %7.2fx\n", "qsort + strcmp", t_qsort * 1e3, 1.0);
+    printf("  %-26s | %9.1f | %7.2fx%s\n", "str_sort", t_sort * 1e3,
+           t_sort > 0 ? t_qsort / t_sort : 0.0, ok ? "" : "  (结果不一致 / MISMATCH)");
+
+    // 忽略大小写（只比较键，大小写不同的相等名字顺序可以不同）
+    // Case-insensitive (compare keys only; names equal up to case may be ordered differently)
+    memcpy(a, names, count * sizeof(char *));
+    start = bench_now();
+    qsort(a, count, sizeof(char *), compare_icase);
+    double t_qsort_icase = bench_now() - start;
+
+    memcpy(b, names, count * sizeof(char *));
+    start = bench_now();
+    ok = str_sort_icase(b, count);
+    double t_sort_icase = bench_now() - start;
+    for (size_t i = 0; ok && i < count; i++) {
+        ok = compare_icase(&a[i], &b[i]) == 0;
+    }
+    printf("  %-26s | %9.1f | %7.2fx\n", "qsort + tolower compare", t_qsort_icase * 1e3, 1.0);
+    printf("  %-26s | %9.1f | %7.2fx%s\n", "str_sort_icase", t_sort_icase * 1e3,
+           t_sort_icase > 0 ? t_qsort_icase / t_sort_icase : 0.0,
+           ok ? "" : "  (结果不一致 / MISMATCH)");
+    all_ok = all_ok && ok;
+    bench_consume((uintptr_t)b[count / 2]);
+
+    // 长公共前缀：偶数下标的字符串完全相同，奇数下标的在前缀之后不同
+    // Long shared prefix: even-indexed strings are identical, odd-indexed ones differ after the prefix
+    char *long_storage = malloc((size_t)LONG_COUNT * (LONG_LENGTH + 1));
+    const char **la = malloc(LONG_COUNT * sizeof(char *));
+    const char **lb = malloc(LONG_COUNT * sizeof(char *));
+    if (long_storage == NULL || la == NULL || lb == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < LONG_COUNT; i++) {
+        char *s = long_storage + i * (LONG_LENGTH + 1);
+        memset(s, 'x', LONG_LENGTH);
+        s[LONG_LENGTH] = '\0';
+        if (i % 2 == 1) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            char tail[24];
+            int n = snprintf(tail, sizeof(tail), "%llu", (unsigned long long)(state % 1000000));
+            memcpy(s + LONG_SHARED, tail, (size_t)n);
+        }
+        la[i] = s;
+        lb[i] = s;
+    }
+    start = bench_now();
+    qsort(la, LONG_COUNT, sizeof(char *), compare_strcmp);
+    double t_qsort_long = bench_now() - start;
+    start = bench_now();
+    ok = str_sort(lb, LONG_COUNT);
+    double t_sort_long = bench_now() - start;
+    for (size_t i = 0; ok && i < LONG_COUNT; i++) {
+        ok = strcmp(la[i], lb[i]) == 0;
+    }
+    all_ok = all_ok && ok;
+    printf("\n  %d 个 %d 字节的字符串，公共前缀 %d 字节 / %d strings of %d bytes, %d-byte shared prefix\n\n",
+           LONG_COUNT, LONG_LENGTH, LONG_SHARED, LONG_COUNT, LONG_LENGTH, LONG_SHARED);
+    printf("  %-26s | %9s | %8s\n", "method", "ms", "speedup");
+    printf("  ---------------------------+-----------+---------\n");
+    printf("  %-26s | %9.1f | %7.2fx\n", "qsort + strcmp", t_qsort_long * 1e3, 1.0);
+    printf("  %-26s | %9.1f | %7.2fx%s\n", "str_sort", t_sort_long * 1e3,
+           t_sort_long > 0 ? t_qsort_long / t_sort_long : 0.0, ok ? "" : "  (结果不一致 / MISMATCH)");
+
+    free(long_storage);
+    free(la);
+    free(lb);
+    free(storage);
+    free(names);
+    free(a);
+    free(b);
+    return all_ok ? 0 : 1;
+}
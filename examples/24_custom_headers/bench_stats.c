@@ -0,0 +1,81 @@
+/**
+ * 数组统计基准测试 / Array Statistics Benchmark
+ *
+ * 对比分别调用utils_array_sum/average/max/min（多次遍历）与一次遍历的utils_array_stats
+ * Compares separate utils_array_sum/average/max/min calls (several passes) with the one-pass
+ * utils_array_stats
+ *
+ * 用法 / Usage:
+ *   ./bench_stats [元素个数 / number of elements, default 16000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils.h"
+#include "bench.h"
+
+// 重复次数 / Repetitions
+#define REPEAT 5
+
+int main(int argc, char *argv[]) {
+    size_t count = 16000000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 16000000;
+        }
+    }
+    int *arr = malloc(count * sizeof(int));
+    if (arr == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < count; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        arr[i] = (int)(state % 2000001) - 1000000;
+    }
+
+    bench_print_title("数组统计 / Array Statistics");
+    printf("  %zu 个int / ints (%.1f MB)\n\n", count, (double)(count * sizeof(int)) / 1e6);
+
+    long sum = 0;
+    double average = 0;
+    int max = 0, min = 0;
+    double start = bench_now();
+    for (int r = 0; r < REPEAT; r++) {
+        sum = utils_array_sum(arr, count);
+        average = utils_array_average(arr, count);
+        utils_array_max(arr, count, &max);
+        utils_array_min(arr, count, &min);
+        bench_consume((uint64_t)sum + (uint64_t)max + (uint64_t)min);
+    }
+    double t_separate = (bench_now() - start) / REPEAT;
+
+    utils_stats_t stats = { 0 };
+    start = bench_now();
+    for (int r = 0; r < REPEAT; r++) {
+        utils_array_stats(arr, count, &stats);
+        bench_consume((uint64_t)stats.sum);
+    }
+    double t_stats = (bench_now() - start) / REPEAT;
+
+    bool same = stats.sum == (long long)sum && stats.min == min && stats.max == max &&
+                stats.mean == average;
+    double bytes = (double)(count * sizeof(int));
+    printf("  %-38s | %9s | %8s\n", "method", "ms", "GB/s");
+    printf("  ---------------------------------------+-----------+---------\n");
+    printf("  %-38s | %9.2f | %8.2f\n", "sum + average + max + min (5 passes)",
+           t_separate * 1e3, bytes / t_separate / 1e9);
+    printf("  %-38s | %9.2f | %8.2f\n", "utils_array_stats (1 pass, + variance)",
+           t_stats * 1e3, bytes / t_stats / 1e9);
+    printf("\n  加速 / Speedup: %.2fx%s\n", t_stats > 0 ? t_separate / t_stats : 0.0,
+           same ? "" : "  (结果不一致 / MISMATCH)");
+    printf("  sum=%lld min=%d max=%d mean=%.3f variance=%.1f\n",
+           stats.sum, stats.min, stats.max, stats.mean, stats.variance);
+
+    free(arr);
+    return 0;
+}
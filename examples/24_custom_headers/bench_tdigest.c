@@ -0,0 +1,157 @@
+/**
+ * t-digest分位数草图基准测试 / t-digest Quantile Sketch Benchmark
+ *
+ * 对一组模拟的请求延迟（对数正态分布），比较t-digest与复制后qsort的精确分位数：
+ *   - 建草图和排序的耗时
+ *   - p50/p90/p99/p999/p9999的估计值、相对误差和秩误差
+ * On simulated request latencies (log-normal), compares t-digest with exact quantiles from a copy + qsort:
+ *   - time to build the sketch versus sorting
+ *   - p50/p90/p99/p999/p9999 estimates with their relative and rank errors
+ *
+ * 用法 / Usage:
+ *   ./bench_tdigest [值的个数 / number of values, default 4000000]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tdigest.h"
+#include "bench.h"
+
+// 模拟的分片数，用于演示合并 / Number of simulated shards, to show merging
+#define SHARDS 8
+
+static uint64_t rng_state = 88172645463325252ull;
+
+// (0, 1)上的均匀分布 / Uniform on (0, 1)
+static double next_uniform(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return ((double)(rng_state >> 11) + 0.5) / 9007199254740992.0;
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// 有序数组中不超过value的比例 / Fraction of a sorted array at or below value
+static double exact_rank(const double *sorted, size_t count, double value) {
+    size_t lo = 0, hi = count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (sorted[mid] <= value) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return (double)lo / (double)count;
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 4000000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 4000000;
+        }
+    }
+    double *values = malloc(count * sizeof(double));
+    double *sorted = malloc(count * sizeof(double));
+    if (values == NULL || sorted == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    // Box-Muller生成对数正态延迟，中位数约20ms / Box-Muller log-normal latencies with a median of about 20 ms
+    for (size_t i = 0; i < count; i++) {
+        double z = sqrt(-2.0 * log(next_uniform())) * cos(6.283185307179586 * next_uniform());
+        values[i] = 20.0 * exp(0.8 * z);
+    }
+
+    bench_print_title("t-digest分位数草图 / t-digest Quantile Sketch");
+    printf("  %zu 个延迟值 / latency values, δ = %d\n\n", count, TDIGEST_DEFAULT_COMPRESSION);
+
+    // 精确：复制后排序 / Exact: copy and sort
+    double start = bench_now();
+    memcpy(sorted, values, count * sizeof(double));
+    qsort(sorted, count, sizeof(double), compare_double);
+    double t_sort = bench_now() - start;
+
+    // 逐个加入 / One value at a time
+    tdigest_t single;
+    if (!tdigest_init(&single, TDIGEST_DEFAULT_COMPRESSION)) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    start = bench_now();
+    for (size_t i = 0; i < count; i++) {
+        tdigest_add(&single, values[i]);
+    }
+    tdigest_quantile(&single, 0.5);
+    double t_add = bench_now() - start;
+
+    // 批量加入 / In batches
+    tdigest_t digest;
+    if (!tdigest_init(&digest, TDIGEST_DEFAULT_COMPRESSION)) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    start = bench_now();
+    tdigest_add_array(&digest, values, count);
+    tdigest_quantile(&digest, 0.5);
+    double t_batch = bench_now() - start;
+
+    // 每个分片一个草图，最后合并 / One sketch per shard, merged at the end
+    tdigest_t merged;
+    if (!tdigest_init(&merged, TDIGEST_DEFAULT_COMPRESSION)) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    start = bench_now();
+    for (size_t s = 0; s < SHARDS; s++) {
+        tdigest_t shard;
+        if (!tdigest_init(&shard, TDIGEST_DEFAULT_COMPRESSION)) {
+            fprintf(stderr, "内存不足 / Out of memory\n");
+            return 1;
+        }
+        size_t lo = count * s / SHARDS, hi = count * (s + 1) / SHARDS;
+        tdigest_add_array(&shard, values + lo, hi - lo);
+        tdigest_merge(&merged, &shard);
+        tdigest_free(&shard);
+    }
+    tdigest_quantile(&merged, 0.5);
+    double t_merge = bench_now() - start;
+
+    printf("  %-36s | %10s | %10s\n", "method", "ms", "ns/value");
+    printf("  -------------------------------------+------------+-----------\n");
+    printf("  %-36s | %10.1f | %10.1f\n", "copy + qsort (exact)", t_sort * 1e3, t_sort * 1e9 / (double)count);
+    printf("  %-36s | %10.1f | %10.1f\n", "tdigest_add (per value)", t_add * 1e3, t_add * 1e9 / (double)count);
+    printf("  %-36s | %10.1f | %10.1f\n", "tdigest_add_array", t_batch * 1e3, t_batch * 1e9 / (double)count);
+    printf("  %-36s | %10.1f | %10.1f\n", "8 shards + tdigest_merge", t_merge * 1e3, t_merge * 1e9 / (double)count);
+    printf("  草图 / Sketch: %zu 个质心 / centroids, %zu KB\n\n", digest.num_centroids,
+           (digest.centroid_capacity * 2 + digest.buffer_capacity * 2) * sizeof(tdigest_centroid_t) / 1024);
+
+    const double quantiles[] = { 0.5, 0.9, 0.99, 0.999, 0.9999 };
+    const char *names[] = { "p50", "p90", "p99", "p999", "p9999" };
+    printf("  %-6s | %12s | %12s | %10s | %12s | %12s\n", "", "exact ms", "estimate ms", "rel. err",
+           "rank err", "merged err");
+    printf("  -------+--------------+--------------+------------+--------------+-------------\n");
+    for (size_t i = 0; i < sizeof(quantiles) / sizeof(quantiles[0]); i++) {
+        double exact = sorted[(size_t)(quantiles[i] * (double)(count - 1))];
+        double estimate = tdigest_quantile(&digest, quantiles[i]);
+        double merged_estimate = tdigest_quantile(&merged, quantiles[i]);
+        printf("  %-6s | %12.3f | %12.3f | %9.3f%% | %12.2e | %11.3f%%\n", names[i], exact, estimate,
+               100.0 * (estimate - exact) / exact, exact_rank(sorted, count, estimate) - quantiles[i],
+               100.0 * (merged_estimate - exact) / exact);
+    }
+
+    tdigest_free(&single);
+    tdigest_free(&digest);
+    tdigest_free(&merged);
+    free(values);
+    free(sorted);
+    return 0;
+}
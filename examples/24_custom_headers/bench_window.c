@@ -0,0 +1,134 @@
+/**
+ * 滑动窗口聚合基准测试 / Sliding-Window Aggregates Benchmark
+ *
+ * 每来一个样本就求最近w个样本的最小值、最大值和平均值：对比每次用utils_array_stats重算整个窗口（O(w)）
+ * 与window.h的单调队列（均摊O(1)），再测按时间的窗口批量加入
+ * After every sample, computes the minimum, maximum and mean of the last w samples: compares recomputing
+ * the whole window with utils_array_stats (O(w)) against the monotonic queues of window.h (amortized O(1)),
+ * then measures batched adds into a time window
+ *
+ * 用法 / Usage:
+ *   ./bench_window [样本数 / number of samples, default 2000000]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils.h"
+#include "window.h"
+#include "bench.h"
+
+// 重算方法最多处理的样本数，窗口大时它太慢 / Most samples the recomputing method handles, since it is slow for large windows
+#define NAIVE_MAX 100000
+
+// 批量加入时每批的样本数 / Samples per batch when adding in batches
+#define BATCH 1000
+
+int main(int argc, char *argv[]) {
+    size_t count = 2000000;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 2000000;
+        }
+    }
+    int *samples = malloc(count * sizeof(int));
+    long long *times = malloc(count * sizeof(long long));
+    if (samples == NULL || times == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+    // 随机游走的样本，时间戳间隔0到3ms / Random-walk samples with timestamps 0 to 3 ms apart
+    uint64_t state = 88172645463325252ull;
+    int level = 0;
+    long long now = 0;
+    for (size_t i = 0; i < count; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        level += (int)(state % 201) - 100;
+        samples[i] = level;
+        now += (long long)(state >> 40) % 4;
+        times[i] = now;
+    }
+
+    bench_print_title("滑动窗口聚合 / Sliding-Window Aggregates");
+    printf("  %zu 个样本 / samples\n\n", count);
+    printf("  %-30s | %12s | %12s | %8s | %s\n", "window", "stats ns/op", "window ns/op", "speedup", "check");
+    printf("  -------------------------------+--------------+--------------+----------+---------\n");
+
+    const size_t lengths[] = { 16, 256, 4096 };
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        size_t length = lengths[l];
+        size_t naive_count = count < NAIVE_MAX ? count : NAIVE_MAX;
+
+        // 每个样本重算一次窗口 / Recompute the window for every sample
+        long long naive_check = 0;
+        double start = bench_now();
+        for (size_t i = 0; i < naive_count; i++) {
+            size_t lo = i + 1 > length ? i + 1 - length : 0;
+            utils_stats_t stats;
+            utils_array_stats(samples + lo, i + 1 - lo, &stats);
+            naive_check += stats.min + stats.max + (long long)stats.mean;
+        }
+        double t_naive = (bench_now() - start) / (double)naive_count;
+
+        window_t window;
+        if (!window_init(&window, length)) {
+            fprintf(stderr, "内存不足 / Out of memory\n");
+            return 1;
+        }
+        long long check = 0, total = 0;
+        start = bench_now();
+        for (size_t i = 0; i < count; i++) {
+            window_add(&window, samples[i]);
+            int min = 0, max = 0;
+            window_min(&window, &min);
+            window_max(&window, &max);
+            total += min + max + (long long)window_mean(&window);
+            if (i + 1 == naive_count) {
+                check = total;
+            }
+        }
+        double t_window = (bench_now() - start) / (double)count;
+        bench_consume((uint64_t)total);
+        window_free(&window);
+
+        char name[48];
+        snprintf(name, sizeof(name), "last %zu samples", length);
+        printf("  %-30s | %12.1f | %12.1f | %7.1fx | %s\n", name, t_naive * 1e9, t_window * 1e9,
+               t_window > 0 ? t_naive / t_window : 0.0, check == naive_check ? "ok" : "MISMATCH");
+    }
+
+    // 按时间的窗口：逐个加入与每批BATCH个 / Time window: one at a time versus BATCH at a time
+    printf("\n  %-30s | %12s | %12s\n", "time window (1 s)", "ns/sample", "final count");
+    printf("  -------------------------------+--------------+--------------\n");
+    for (int batched = 0; batched <= 1; batched++) {
+        window_t window;
+        if (!window_init_timed(&window, 1000)) {
+            fprintf(stderr, "内存不足 / Out of memory\n");
+            return 1;
+        }
+        double start = bench_now();
+        if (batched) {
+            for (size_t i = 0; i < count; i += BATCH) {
+                size_t n = count - i < BATCH ? count - i : BATCH;
+                window_add_array_at(&window, times + i, samples + i, n);
+            }
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                window_add_at(&window, times[i], samples[i]);
+            }
+        }
+        double t = (bench_now() - start) / (double)count;
+        int min = 0;
+        window_min(&window, &min);
+        bench_consume((uint64_t)min);
+        printf("  %-30s | %12.1f | %12zu\n", batched ? "window_add_array_at (1000)" : "window_add_at", t * 1e9,
+               window_count(&window));
+        window_free(&window);
+    }
+
+    free(samples);
+    free(times);
+    return 0;
+}
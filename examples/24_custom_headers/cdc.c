@@ -0,0 +1,352 @@
+/**
+ * 内容定义分块实现文件 / Content-Defined Chunking Implementation
+ *
+ * Gear哈希每读一个字节做一次移位和一次加法：h = (h << 1) + gear[byte]，
+ * 64位的h只记得最近64个字节，所以切分点只取决于附近的内容。
+ * 掩码取h的最高几位（它们受最多字节影响），这几位全为0时切分。
+ * The Gear hash costs one shift and one add per byte: h = (h << 1) + gear[byte];
+ * a 64-bit h only remembers the last 64 bytes, so cut points depend only on nearby content.
+ * The masks take the top bits of h (the ones influenced by the most bytes) and a cut happens when they are all 0.
+ *
+ * 参考 / Reference: Xia et al., "FastCDC: a Fast and Efficient Content-Defined Chunking Approach
+ * for Data Deduplication", USENIX ATC 2016.
+ */
+
+// fseeko/off_t需要POSIX声明，32位系统上也用64位的off_t
+// fseeko/off_t need the POSIX declarations, and a 64-bit off_t even on 32-bit systems
+#define _POSIX_C_SOURCE 200809L
+#define _FILE_OFFSET_BITS 64
+
+#include "cdc.h"
+#include "hash.h"     // 用于 hash64 / For hash64
+#include <stdlib.h>   // 用于 malloc, calloc, free / For malloc, calloc, free
+#include <string.h>   // 用于 memmove, memset / For memmove, memset
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <sys/types.h>  // 用于 off_t / For off_t
+#endif
+
+// 归一化级别：平均大小前后掩码相差的位数 / Normalization level: mask bits added/removed around the average
+#define CDC_NORMALIZATION 2
+
+// 指纹的两个种子 / The two fingerprint seeds
+#define CDC_SEED_HI 0x9E3779B97F4A7C15ull
+#define CDC_SEED_LO 0xC2B2AE3D27D4EB4Full
+
+// 指纹表的初始槽数 / Initial slots of the fingerprint table
+#define CDC_INITIAL_CAPACITY 1024
+
+// =====================================================================
+// 分块 / Chunking
+// =====================================================================
+
+// splitmix64，用来生成gear表 / splitmix64, used to fill the gear table
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// 最高n位为1的掩码 / Mask with the top n bits set
+static uint64_t top_bits(unsigned n) {
+    return n == 0 ? 0 : ~0ull << (64 - n);
+}
+
+// 初始化分块器 / Initialize a chunker
+bool cdc_init(cdc_chunker_t *chunker, size_t min_size, size_t avg_size, size_t max_size) {
+    if (chunker == NULL || min_size < 64 || min_size >= avg_size || avg_size >= max_size ||
+        max_size > ((size_t)1 << 31) || (avg_size & (avg_size - 1)) != 0) {
+        return false;
+    }
+    uint64_t state = 0;
+    for (int i = 0; i < 256; i++) {
+        chunker->gear[i] = splitmix64(&state);
+    }
+    unsigned bits = 0;
+    while (((size_t)1 << bits) < avg_size) {
+        bits++;
+    }
+    chunker->mask_small = top_bits(bits + CDC_NORMALIZATION);
+    chunker->mask_large = top_bits(bits - CDC_NORMALIZATION);
+    chunker->min_size = min_size;
+    chunker->avg_size = avg_size;
+    chunker->max_size = max_size;
+    return true;
+}
+
+// 在[i, end)中找第一个切分点，返回切分后的长度，没有时返回0
+// Find the first cut point in [i, end), returning the chunk length there, or 0 when there is none
+//
+// 每次处理两个字节：h2 = (h << 2) + ((gear[a] << 1) + gear[b])，括号里的部分不依赖h，
+// 所以h的依赖链每两个字节只有一次移位加一次加法；中间的h1从同一个h另外算出来，切分点和逐字节完全相同
+// Two bytes per iteration: in h2 = (h << 2) + ((gear[a] << 1) + gear[b]) the bracketed part does not
+// depend on h, so the dependency chain on h is one shift and one add per two bytes; the h1 in between
+// is computed from the same h on the side, and the cut points are exactly those of the byte-wise loop
+static size_t gear_scan(const uint64_t *gear, const unsigned char *p, size_t i, size_t end,
+                        uint64_t mask, uint64_t *hash) {
+    uint64_t h = *hash;
+    for (; i + 1 < end; i += 2) {
+        uint64_t a = gear[p[i]];
+        uint64_t h1 = (h << 1) + a;
+        h = (h << 2) + ((a << 1) + gear[p[i + 1]]);
+        if ((h1 & mask) == 0) {
+            return i + 1;
+        }
+        if ((h & mask) == 0) {
+            return i + 2;
+        }
+    }
+    if (i < end) {
+        h = (h << 1) + gear[p[i]];
+        if ((h & mask) == 0) {
+            return i + 1;
+        }
+    }
+    *hash = h;
+    return 0;
+}
+
+// 下一个块的长度 / Length of the next chunk
+size_t cdc_next(const cdc_chunker_t *chunker, const void *data, size_t len) {
+    const unsigned char *p = data;
+    if (chunker == NULL || p == NULL) {
+        return 0;
+    }
+    if (len <= chunker->min_size) {
+        return len;
+    }
+    size_t end = len < chunker->max_size ? len : chunker->max_size;
+    size_t normal = chunker->avg_size < end ? chunker->avg_size : end;
+
+    // 最小块之前的字节不可能成为切分点，直接跳过 / Bytes before the minimum size cannot be cut points, so skip them
+    uint64_t h = 0;
+    size_t cut = gear_scan(chunker->gear, p, chunker->min_size, normal, chunker->mask_small, &h);
+    if (cut == 0) {
+        cut = gear_scan(chunker->gear, p, normal, end, chunker->mask_large, &h);
+    }
+    return cut != 0 ? cut : end;
+}
+
+// 计算块指纹 / Compute a chunk fingerprint
+cdc_fingerprint_t cdc_fingerprint(const void *data, size_t len) {
+    cdc_fingerprint_t fp;
+    if (data == NULL) {
+        fp.hi = 0;
+        fp.lo = 0;
+        return fp;
+    }
+    fp.hi = hash64(data, len, CDC_SEED_HI);
+    fp.lo = hash64(data, len, CDC_SEED_LO);
+    return fp;
+}
+
+// =====================================================================
+// 去重存储 / Dedupe Store
+// =====================================================================
+
+// 打开去重存储 / Open a dedupe store
+bool cdc_store_open(cdc_store_t *store, const char *pack_path) {
+    if (store == NULL) {
+        return false;
+    }
+    memset(store, 0, sizeof(*store));
+    store->slots = calloc(CDC_INITIAL_CAPACITY, sizeof(cdc_ref_t));
+    if (store->slots == NULL) {
+        return false;
+    }
+    store->capacity = CDC_INITIAL_CAPACITY;
+    if (pack_path != NULL) {
+        // 读写模式，cdc_store_read可以读回已写的块 / Read-write, so cdc_store_read can read chunks back
+        store->pack = fopen(pack_path, "w+b");
+        if (store->pack == NULL) {
+            free(store->slots);
+            store->slots = NULL;
+            return false;
+        }
+    }
+    return true;
+}
+
+// 在包文件中定位；偏移放不进文件偏移类型时失败，而不是截断
+// Seek in the pack file; fails instead of truncating when the offset does not fit the file offset type
+static bool pack_seek(FILE *pack, uint64_t offset, int whence) {
+    if (offset > (uint64_t)INT64_MAX) {
+        return false;
+    }
+#if defined(_WIN32) || defined(_WIN64)
+    // long在Windows上只有32位 / long is only 32 bits on Windows
+    return _fseeki64(pack, (__int64)offset, whence) == 0;
+#else
+    if (sizeof(off_t) < sizeof(int64_t) && offset > (((uint64_t)1 << (sizeof(off_t) * 8 - 1)) - 1)) {
+        return false;
+    }
+    return fseeko(pack, (off_t)offset, whence) == 0;
+#endif
+}
+
+// 指纹表扩容一倍 / Double the fingerprint table
+static bool store_grow(cdc_store_t *store) {
+    size_t capacity = store->capacity * 2;
+    cdc_ref_t *slots = calloc(capacity, sizeof(cdc_ref_t));
+    if (slots == NULL) {
+        return false;
+    }
+    size_t mask = capacity - 1;
+    for (size_t i = 0; i < store->capacity; i++) {
+        if (store->slots[i].length != 0) {
+            size_t j = (size_t)store->slots[i].fingerprint.lo & mask;
+            while (slots[j].length != 0) {
+                j = (j + 1) & mask;
+            }
+            slots[j] = store->slots[i];
+        }
+    }
+    free(store->slots);
+    store->slots = slots;
+    store->capacity = capacity;
+    return true;
+}
+
+// 存入一个块 / Store one chunk
+bool cdc_store_put(cdc_store_t *store, const void *data, size_t len, cdc_ref_t *ref) {
+    if (store == NULL || data == NULL || len == 0 || len > UINT32_MAX) {
+        return false;
+    }
+    cdc_fingerprint_t fp = cdc_fingerprint(data, len);
+
+    size_t mask = store->capacity - 1;
+    size_t i = (size_t)fp.lo & mask;
+    while (store->slots[i].length != 0) {
+        const cdc_ref_t *slot = &store->slots[i];
+        if (slot->fingerprint.lo == fp.lo && slot->fingerprint.hi == fp.hi && slot->length == len) {
+            if (ref != NULL) {
+                *ref = *slot;
+            }
+            store->stats.chunks++;
+            store->stats.bytes_in += len;
+            return true;
+        }
+        i = (i + 1) & mask;
+    }
+
+    // 插入前先扩容，保持负载不超过1/2；扩容失败时存储不变
+    // Grow before inserting to keep the load at or below 1/2; a failed grow leaves the store unchanged
+    if ((store->stats.unique_chunks + 1) * 2 > store->capacity) {
+        if (!store_grow(store)) {
+            return false;
+        }
+        mask = store->capacity - 1;
+        i = (size_t)fp.lo & mask;
+        while (store->slots[i].length != 0) {
+            i = (i + 1) & mask;
+        }
+    }
+
+    // 新块：追加到包文件末尾 / New chunk: append it to the pack file
+    cdc_ref_t *slot = &store->slots[i];
+    slot->fingerprint = fp;
+    slot->offset = store->stats.bytes_stored;
+    slot->length = (uint32_t)len;
+    if (store->pack != NULL) {
+        // 写在已记录的末尾，之前写失败留下的半个块会被覆盖
+        // Write at the recorded end, so half a chunk left by an earlier failed write is overwritten
+        if (!pack_seek(store->pack, store->stats.bytes_stored, SEEK_SET) || fwrite(data, 1, len, store->pack) != len) {
+            slot->length = 0;
+            return false;
+        }
+    }
+    if (ref != NULL) {
+        *ref = *slot;
+    }
+    store->stats.chunks++;
+    store->stats.bytes_in += len;
+    store->stats.unique_chunks++;
+    store->stats.bytes_stored += len;
+    return true;
+}
+
+// 把一段内存分块后存入 / Chunk a buffer and store it
+bool cdc_store_add_buffer(cdc_store_t *store, const cdc_chunker_t *chunker, const void *data, size_t len) {
+    const unsigned char *p = data;
+    if (store == NULL || chunker == NULL || (p == NULL && len > 0)) {
+        return false;
+    }
+    while (len > 0) {
+        size_t n = cdc_next(chunker, p, len);
+        if (!cdc_store_put(store, p, n, NULL)) {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+// 把文件分块后存入 / Chunk a file and store it
+bool cdc_store_add_file(cdc_store_t *store, const cdc_chunker_t *chunker, const char *path) {
+    if (store == NULL || chunker == NULL || path == NULL) {
+        return false;
+    }
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    // 缓冲区是最大块的4倍，剩余不足一个最大块时把它移到开头再读
+    // The buffer holds 4 maximum chunks; when less than one remains it moves to the front and more is read
+    size_t capacity = chunker->max_size * 4;
+    unsigned char *buffer = malloc(capacity);
+    if (buffer == NULL) {
+        fclose(file);
+        return false;
+    }
+    size_t start = 0, filled = 0;
+    bool eof = false, ok = true;
+    while (ok) {
+        if (!eof && filled - start < chunker->max_size) {
+            memmove(buffer, buffer + start, filled - start);
+            filled -= start;
+            start = 0;
+            size_t want = capacity - filled;
+            size_t got = fread(buffer + filled, 1, want, file);
+            filled += got;
+            if (got < want) {
+                eof = true;
+                ok = !ferror(file);
+            }
+        }
+        if (start == filled) {
+            break;
+        }
+        size_t n = cdc_next(chunker, buffer + start, filled - start);
+        ok = ok && cdc_store_put(store, buffer + start, n, NULL);
+        start += n;
+    }
+    free(buffer);
+    fclose(file);
+    return ok;
+}
+
+// 从包文件读回一个块 / Read a chunk back from the pack file
+bool cdc_store_read(cdc_store_t *store, const cdc_ref_t *ref, void *buffer) {
+    if (store == NULL || ref == NULL || buffer == NULL || store->pack == NULL || ref->offset > store->stats.bytes_stored ||
+        ref->length > store->stats.bytes_stored - ref->offset) {
+        return false;
+    }
+    return pack_seek(store->pack, ref->offset, SEEK_SET) &&
+           fread(buffer, 1, ref->length, store->pack) == ref->length;
+}
+
+// 关闭存储 / Close a store
+bool cdc_store_close(cdc_store_t *store) {
+    if (store == NULL) {
+        return false;
+    }
+    bool ok = true;
+    if (store->pack != NULL) {
+        ok = fclose(store->pack) == 0;
+    }
+    free(store->slots);
+    memset(store, 0, sizeof(*store));
+    return ok;
+}
@@ -0,0 +1,174 @@
+/**
+ * 内容定义分块头文件 / Content-Defined Chunking Header
+ *
+ * FastCDC：用Gear滚动哈希在内容决定的位置切分数据流，插入或删除几个字节只影响附近的块，
+ * 其余块保持不变，所以可以按块去重；去重存储只把没见过的块写进包文件
+ * FastCDC: a Gear rolling hash cuts a stream at positions chosen by its content, so inserting or
+ * deleting a few bytes only changes the nearby chunks and the rest stay identical, which makes
+ * chunk-level deduplication work; the dedupe store writes only unseen chunks to a pack file
+ */
+
+#ifndef CDC_H
+#define CDC_H
+
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdint.h>   // 用于 uint32_t, uint64_t / For uint32_t, uint64_t
+#include <stdio.h>    // 用于 FILE / For FILE
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 默认块大小 / Default chunk sizes
+#define CDC_DEFAULT_MIN (2 * 1024)
+#define CDC_DEFAULT_AVG (8 * 1024)
+#define CDC_DEFAULT_MAX (64 * 1024)
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 分块器参数 / Chunker parameters
+typedef struct {
+    uint64_t gear[256];     // 每个字节值对应的随机数 / One random number per byte value
+    uint64_t mask_small;    // 平均大小之前用的掩码（更难满足）/ Mask before the average size (harder to hit)
+    uint64_t mask_large;    // 平均大小之后用的掩码（更容易满足）/ Mask after the average size (easier to hit)
+    size_t min_size;        // 最小块 / Minimum chunk size
+    size_t avg_size;        // 平均块（2的幂）/ Average chunk size (a power of two)
+    size_t max_size;        // 最大块 / Maximum chunk size
+} cdc_chunker_t;
+
+// 块指纹（128位，非加密）/ Chunk fingerprint (128 bits, not cryptographic)
+typedef struct {
+    uint64_t hi;
+    uint64_t lo;
+} cdc_fingerprint_t;
+
+// 块在包文件中的位置 / Location of a chunk in the pack file
+typedef struct {
+    cdc_fingerprint_t fingerprint;
+    uint64_t offset;        // 包文件中的偏移 / Offset in the pack file
+    uint32_t length;        // 块长度 / Chunk length
+} cdc_ref_t;
+
+// 去重统计 / Dedupe statistics
+typedef struct {
+    uint64_t chunks;        // 输入的块数 / Chunks seen
+    uint64_t unique_chunks; // 不重复的块数 / Distinct chunks
+    uint64_t bytes_in;      // 输入字节数 / Bytes seen
+    uint64_t bytes_stored;  // 写入包文件的字节数 / Bytes written to the pack file
+} cdc_stats_t;
+
+// 去重存储 / Dedupe store
+typedef struct {
+    cdc_ref_t *slots;       // 指纹表（开放寻址，length为0表示空槽）/ Fingerprint table (open addressing, length 0 for empty)
+    size_t capacity;        // 槽数（2的幂）/ Number of slots (a power of two)
+    FILE *pack;             // 包文件，NULL表示只统计 / Pack file, NULL to only count
+    cdc_stats_t stats;      // 统计 / Statistics
+} cdc_store_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 初始化分块器 / Initialize a chunker
+ *
+ * 平均大小之前用多2位的掩码、之后用少2位的掩码（归一化分块），块大小集中在平均值附近
+ * Uses a mask with 2 more bits before the average size and 2 fewer after it (normalized chunking),
+ * which concentrates chunk sizes around the average
+ *
+ * @param chunker 分块器 / Chunker
+ * @param min_size 最小块 / Minimum chunk size
+ * @param avg_size 平均块，必须是2的幂 / Average chunk size, must be a power of two
+ * @param max_size 最大块 / Maximum chunk size
+ * @return 参数合法（64 <= min < avg < max <= 2^31）返回true
+ *         true if the parameters are valid (64 <= min < avg < max <= 2^31)
+ */
+bool cdc_init(cdc_chunker_t *chunker, size_t min_size, size_t avg_size, size_t max_size);
+
+/**
+ * 下一个块的长度 / Length of the next chunk
+ *
+ * 在data开头找切分点；没有找到时返回min(len, max_size)。如果返回len但数据流还没结束，
+ * 说明缓冲区不够长：调用者应当保留这些字节、读入更多数据后再调用（缓冲区至少max_size字节时不会发生）
+ * Finds a cut point at the start of data; returns min(len, max_size) when there is none. A result of
+ * len before the end of the stream means the buffer was too short: the caller should keep those bytes,
+ * read more and call again (this cannot happen with at least max_size bytes buffered)
+ *
+ * @param chunker 分块器 / Chunker
+ * @param data 数据 / Data
+ * @param len 数据长度 / Data length
+ * @return 块长度（len为0或参数为NULL时返回0）/ Chunk length (0 when len is 0 or an argument is NULL)
+ */
+size_t cdc_next(const cdc_chunker_t *chunker, const void *data, size_t len);
+
+/**
+ * 计算块指纹 / Compute a chunk fingerprint
+ * @param data 数据 / Data
+ * @param len 数据长度 / Data length
+ * @return 指纹 / Fingerprint
+ */
+cdc_fingerprint_t cdc_fingerprint(const void *data, size_t len);
+
+/**
+ * 打开去重存储 / Open a dedupe store
+ * @param store 存储 / Store
+ * @param pack_path 包文件路径（会被覆盖），NULL表示不写文件只统计
+ *                  Pack file path (overwritten), NULL to count without writing
+ * @return 成功返回true / true on success
+ */
+bool cdc_store_open(cdc_store_t *store, const char *pack_path);
+
+/**
+ * 存入一个块：没见过的块追加到包文件，见过的块只返回已有位置
+ * Store one chunk: an unseen chunk is appended to the pack file, a known one just returns its location
+ *
+ * @param store 存储 / Store
+ * @param data 块数据 / Chunk data
+ * @param len 块长度（1..UINT32_MAX）/ Chunk length (1..UINT32_MAX)
+ * @param ref 输出：块的位置，可以为NULL / Output: the chunk's location, may be NULL
+ * @return 成功返回true，内存不足或写入失败返回false，存储不变
+ *         true on success, false when out of memory or a write fails, leaving the store unchanged
+ */
+bool cdc_store_put(cdc_store_t *store, const void *data, size_t len, cdc_ref_t *ref);
+
+/**
+ * 把一段内存分块后存入 / Chunk a buffer and store it
+ * @param store 存储 / Store
+ * @param chunker 分块器 / Chunker
+ * @param data 数据 / Data
+ * @param len 数据长度 / Data length
+ * @return 成功返回true / true on success
+ */
+bool cdc_store_add_buffer(cdc_store_t *store, const cdc_chunker_t *chunker, const void *data, size_t len);
+
+/**
+ * 把文件分块后存入（流式读取，内存占用与文件大小无关）
+ * Chunk a file and store it (streamed, so memory use does not depend on the file size)
+ *
+ * @param store 存储 / Store
+ * @param chunker 分块器 / Chunker
+ * @param path 文件路径 / File path
+ * @return 成功返回true / true on success
+ */
+bool cdc_store_add_file(cdc_store_t *store, const cdc_chunker_t *chunker, const char *path);
+
+/**
+ * 从包文件读回一个块 / Read a chunk back from the pack file
+ * @param store 存储 / Store
+ * @param ref 块的位置 / Chunk location
+ * @param buffer 输出（至少ref->length字节）/ Output (at least ref->length bytes)
+ * @return 成功返回true / true on success
+ */
+bool cdc_store_read(cdc_store_t *store, const cdc_ref_t *ref, void *buffer);
+
+/**
+ * 关闭存储（包文件保留在磁盘上）/ Close a store (the pack file stays on disk)
+ * @param store 存储 / Store
+ * @return 包文件成功写完返回true / true if the pack file was written out successfully
+ */
+bool cdc_store_close(cdc_store_t *store);
+
+#endif // CDC_H
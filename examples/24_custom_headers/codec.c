@@ -0,0 +1,472 @@
+/**
+ * 编码转换实现文件 / Encoding Codec Implementation
+ *
+ * 十六进制：SSE2每次处理16字节；半字节通过"比较+加法"转成字符，无需查表
+ * Hex: SSE2 handles 16 bytes per step; nibbles become characters via compare+add, no table
+ *
+ * Base64：SSSE3用pshufb做6位索引<->字符的查表（Wojciech Muła的算法），运行时检测CPU
+ * Base64: SSSE3 uses pshufb for sextet<->character lookups (Wojciech Muła's method), detected at run time
+ *
+ * 所有SIMD路径都有标量尾部处理和纯标量回退
+ * Every SIMD path has a scalar tail and a pure scalar fallback
+ */
+
+#include "codec.h"
+#include <stdint.h>   // 用于 uint8_t / For uint8_t
+#include <string.h>   // 用于 memcpy / For memcpy
+
+#if defined(__SSE2__)
+#include <emmintrin.h>  // SSE2
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h>  // SSSE3（通过target属性启用）/ SSSE3 (enabled via the target attribute)
+#define CODEC_HAVE_SSSE3 1
+#endif
+
+// =====================================================================
+// 常量与表 / Constants and Tables
+// =====================================================================
+
+static const char hex_lower[] = "0123456789abcdef";
+static const char hex_upper[] = "0123456789ABCDEF";
+
+static const char base64_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// 字符 -> 半字节值，0xFF表示非法 / Character -> nibble value, 0xFF means invalid
+static const uint8_t hex_values[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+       0,    1,    2,    3,    4,    5,    6,    7,    8,    9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,   10,   11,   12,   13,   14,   15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,   10,   11,   12,   13,   14,   15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+// 字符 -> 6位值，0xFF表示非法 / Character -> sextet value, 0xFF means invalid
+static const uint8_t base64_values[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   62, 0xFF, 0xFF, 0xFF,   63,
+      52,   53,   54,   55,   56,   57,   58,   59,   60,   61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+      15,   16,   17,   18,   19,   20,   21,   22,   23,   24,   25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF,   26,   27,   28,   29,   30,   31,   32,   33,   34,   35,   36,   37,   38,   39,   40,
+      41,   42,   43,   44,   45,   46,   47,   48,   49,   50,   51, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+// =====================================================================
+// 十六进制 / Hex
+// =====================================================================
+
+// 十六进制编码 / Hex encode
+size_t hex_encode(char *dst, const void *src, size_t len, bool uppercase) {
+    const uint8_t *in = (const uint8_t *)src;
+    const char *digits = uppercase ? hex_upper : hex_lower;
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i low_mask = _mm_set1_epi8(0x0F);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i ascii_zero = _mm_set1_epi8('0');
+    // 'A'-'0'-10 = 7，'a'-'0'-10 = 39
+    const __m128i letter_gap = _mm_set1_epi8(uppercase ? 7 : 39);
+
+    for (; i + 16 <= len; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(in + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), low_mask);
+        __m128i lo = _mm_and_si128(bytes, low_mask);
+
+        // 半字节 > 9 时额外加上字母间隔 / Add the letter gap where the nibble > 9
+        hi = _mm_add_epi8(_mm_add_epi8(hi, ascii_zero),
+                          _mm_and_si128(_mm_cmpgt_epi8(hi, nine), letter_gap));
+        lo = _mm_add_epi8(_mm_add_epi8(lo, ascii_zero),
+                          _mm_and_si128(_mm_cmpgt_epi8(lo, nine), letter_gap));
+
+        // 交错为 hi0 lo0 hi1 lo1 ... / Interleave as hi0 lo0 hi1 lo1 ...
+        _mm_storeu_si128((__m128i *)(dst + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i *)(dst + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+#endif
+
+    for (; i < len; i++) {
+        dst[2 * i] = digits[in[i] >> 4];
+        dst[2 * i + 1] = digits[in[i] & 0x0F];
+    }
+    dst[2 * len] = '\0';
+    return 2 * len;
+}
+
+// 十六进制解码 / Hex decode
+bool hex_decode(void *dst, const char *src, size_t len, size_t *out_len) {
+    uint8_t *out = (uint8_t *)dst;
+    size_t i = 0;
+
+    if (out_len != NULL) {
+        *out_len = 0;
+    }
+    if (len % 2 != 0) {
+        return false;
+    }
+
+#if defined(__SSE2__)
+    // 有符号比较：>=0x80的字节为负数，不会落在任何合法区间内
+    // Signed compares: bytes >= 0x80 are negative and fall outside every valid range
+    const __m128i below_zero = _mm_set1_epi8('0' - 1);
+    const __m128i above_nine = _mm_set1_epi8('9' + 1);
+    const __m128i below_a = _mm_set1_epi8('a' - 1);
+    const __m128i above_f = _mm_set1_epi8('f' + 1);
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i digit_bias = _mm_set1_epi8('0');
+    const __m128i letter_bias = _mm_set1_epi8('a' - 10);
+    const __m128i byte_mask = _mm_set1_epi16(0x00FF);
+
+    for (; i + 32 <= len; i += 32) {
+        __m128i c0 = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i c1 = _mm_loadu_si128((const __m128i *)(src + i + 16));
+        __m128i v[2];
+        __m128i cs[2] = {c0, c1};
+        int valid = 0xFFFF;
+
+        for (int k = 0; k < 2; k++) {
+            __m128i c = cs[k];
+            __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(c, below_zero),
+                                             _mm_cmplt_epi8(c, above_nine));
+            __m128i lc = _mm_or_si128(c, case_bit);  // 折叠为小写 / Fold to lowercase
+            __m128i is_letter = _mm_and_si128(_mm_cmpgt_epi8(lc, below_a),
+                                              _mm_cmplt_epi8(lc, above_f));
+            valid &= _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter));
+            v[k] = _mm_or_si128(_mm_and_si128(is_digit, _mm_sub_epi8(c, digit_bias)),
+                                _mm_and_si128(is_letter, _mm_sub_epi8(lc, letter_bias)));
+        }
+        if (valid != 0xFFFF) {
+            return false;
+        }
+
+        // 每个16位通道是 hi | (lo << 8)，合成 (hi << 4) | lo
+        // Each 16-bit lane is hi | (lo << 8); combine into (hi << 4) | lo
+        __m128i b0 = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(v[0], 4), byte_mask),
+                                  _mm_srli_epi16(v[0], 8));
+        __m128i b1 = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(v[1], 4), byte_mask),
+                                  _mm_srli_epi16(v[1], 8));
+        _mm_storeu_si128((__m128i *)(out + i / 2), _mm_packus_epi16(b0, b1));
+    }
+#endif
+
+    for (; i < len; i += 2) {
+        uint8_t hi = hex_values[(uint8_t)src[i]];
+        uint8_t lo = hex_values[(uint8_t)src[i + 1]];
+        if (hi > 15 || lo > 15) {
+            return false;
+        }
+        out[i / 2] = (uint8_t)((hi << 4) | lo);
+    }
+
+    if (out_len != NULL) {
+        *out_len = len / 2;
+    }
+    return true;
+}
+
+// =====================================================================
+// Base64 SSSE3 内核 / Base64 SSSE3 Kernels
+// =====================================================================
+
+#if defined(CODEC_HAVE_SSSE3)
+
+// 12字节输入 -> 16个字符；需要可读16字节 / 12 input bytes -> 16 characters; needs 16 readable bytes
+__attribute__((target("ssse3")))
+static size_t base64_encode_ssse3(char *dst, const uint8_t *src, size_t len) {
+    size_t i = 0, o = 0;
+
+    for (; i + 16 <= len; i += 12, o += 16) {
+        __m128i in = _mm_loadu_si128((const __m128i *)(src + i));
+
+        // 每3字节扩展到一个32位通道 / Spread each 3-byte group into one 32-bit lane
+        in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+        // 用乘法代替可变移位，取出4个6位索引 / Multiplies replace variable shifts to extract 4 sextets
+        __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+        __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+        __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(t1, t3);
+
+        // 索引 -> 字符：按区间查出偏移量再相加 / Index -> character: look up a per-range offset and add
+        __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        range = _mm_or_si128(range, _mm_and_si128(less, _mm_set1_epi8(13)));
+        const __m128i shift_lut = _mm_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+            '/' - 63, 'A', 0, 0);
+        __m128i chars = _mm_add_epi8(_mm_shuffle_epi8(shift_lut, range), indices);
+
+        _mm_storeu_si128((__m128i *)(dst + o), chars);
+    }
+    return i;
+}
+
+// 16个字符 -> 12字节；遇到非法字符时停下，返回已处理的字符数
+// 16 characters -> 12 bytes; stops at an invalid character and returns the characters consumed
+__attribute__((target("ssse3")))
+static size_t base64_decode_ssse3(uint8_t *dst, const char *src, size_t len) {
+    size_t i = 0, o = 0;
+    const __m128i shift_lut = _mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71,
+                                            0, 0, 0, 0, 0, 0, 0, 0);
+    // mask_lut[低半字节]的第k位表示"高半字节为k时合法"
+    // Bit k of mask_lut[low nibble] means "valid when the high nibble is k"
+    const __m128i mask_lut = _mm_setr_epi8((char)0xA8, (char)0xF8, (char)0xF8, (char)0xF8,
+                                           (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8,
+                                           (char)0xF8, (char)0xF8, (char)0xF0, 0x54,
+                                           0x50, 0x50, 0x50, 0x54);
+    const __m128i bitpos_lut = _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80,
+                                             0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+    // 每次写16字节但只前进12字节，所以后面至少还要有8个字符（>=4字节输出）覆盖多写的部分
+    // Each step stores 16 bytes but advances 12, so at least 8 more characters (>= 4 output bytes)
+    // must follow to overwrite the excess
+    for (; i + 24 <= len; i += 16, o += 12) {
+        __m128i in = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi32(in, 4), nibble_mask);
+        __m128i lo = _mm_and_si128(in, nibble_mask);
+
+        __m128i valid_bits = _mm_and_si128(_mm_shuffle_epi8(mask_lut, lo),
+                                           _mm_shuffle_epi8(bitpos_lut, hi));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(valid_bits, _mm_setzero_si128())) != 0) {
+            break;
+        }
+
+        // '/'与'+'高半字节相同，单独处理 / '/' shares its high nibble with '+', so handle it separately
+        __m128i is_slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+        __m128i shift = _mm_or_si128(_mm_andnot_si128(is_slash, _mm_shuffle_epi8(shift_lut, hi)),
+                                     _mm_and_si128(is_slash, _mm_set1_epi8(16)));
+        __m128i values = _mm_add_epi8(in, shift);
+
+        // 4个6位值合并为3字节 / Merge four sextets into three bytes
+        __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        merged = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                                        -1, -1, -1, -1));
+        _mm_storeu_si128((__m128i *)(dst + o), merged);
+    }
+    return i;
+}
+
+#endif // CODEC_HAVE_SSSE3
+
+static bool codec_have_ssse3(void) {
+#if defined(CODEC_HAVE_SSSE3)
+    return __builtin_cpu_supports("ssse3");
+#else
+    return false;
+#endif
+}
+
+// =====================================================================
+// Base64
+// =====================================================================
+
+// Base64编码 / Base64 encode
+size_t base64_encode(char *dst, const void *src, size_t len) {
+    const uint8_t *in = (const uint8_t *)src;
+    size_t i = 0, o = 0;
+
+#if defined(CODEC_HAVE_SSSE3)
+    if (codec_have_ssse3()) {
+        i = base64_encode_ssse3(dst, in, len);
+        o = i / 3 * 4;
+    }
+#endif
+
+    // 标量：每3字节 -> 4字符 / Scalar: 3 bytes -> 4 characters
+    for (; i + 3 <= len; i += 3, o += 4) {
+        uint32_t v = ((uint32_t)in[i] << 16) | ((uint32_t)in[i + 1] << 8) | in[i + 2];
+        dst[o] = base64_alphabet[v >> 18];
+        dst[o + 1] = base64_alphabet[(v >> 12) & 0x3F];
+        dst[o + 2] = base64_alphabet[(v >> 6) & 0x3F];
+        dst[o + 3] = base64_alphabet[v & 0x3F];
+    }
+
+    // 剩余1或2字节加填充 / Remaining 1 or 2 bytes plus padding
+    if (i < len) {
+        uint32_t v = (uint32_t)in[i] << 16;
+        if (i + 1 < len) {
+            v |= (uint32_t)in[i + 1] << 8;
+        }
+        dst[o] = base64_alphabet[v >> 18];
+        dst[o + 1] = base64_alphabet[(v >> 12) & 0x3F];
+        dst[o + 2] = (i + 1 < len) ? base64_alphabet[(v >> 6) & 0x3F] : '=';
+        dst[o + 3] = '=';
+        o += 4;
+    }
+    dst[o] = '\0';
+    return o;
+}
+
+// Base64解码 / Base64 decode
+bool base64_decode(void *dst, const char *src, size_t len, size_t *out_len) {
+    uint8_t *out = (uint8_t *)dst;
+    size_t i = 0, o = 0;
+
+    if (out_len != NULL) {
+        *out_len = 0;
+    }
+    if (len % 4 != 0) {
+        return false;
+    }
+    if (len == 0) {
+        return true;
+    }
+
+#if defined(CODEC_HAVE_SSSE3)
+    if (codec_have_ssse3()) {
+        // 出错的块交给下面的标量代码报告 / The failing block is reported by the scalar code below
+        i = base64_decode_ssse3(out, src, len);
+        o = i / 4 * 3;
+    }
+#endif
+
+    // 最后一组可能有填充，单独处理 / The last group may be padded; handle it separately
+    size_t full_end = len - 4;
+    for (; i < full_end; i += 4, o += 3) {
+        uint32_t a = base64_values[(uint8_t)src[i]];
+        uint32_t b = base64_values[(uint8_t)src[i + 1]];
+        uint32_t c = base64_values[(uint8_t)src[i + 2]];
+        uint32_t d = base64_values[(uint8_t)src[i + 3]];
+        if ((a | b | c | d) > 63) {
+            return false;
+        }
+        uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+        out[o] = (uint8_t)(v >> 16);
+        out[o + 1] = (uint8_t)(v >> 8);
+        out[o + 2] = (uint8_t)v;
+    }
+
+    uint32_t a = base64_values[(uint8_t)src[i]];
+    uint32_t b = base64_values[(uint8_t)src[i + 1]];
+    if (a > 63 || b > 63) {
+        return false;
+    }
+    uint32_t v = (a << 18) | (b << 12);
+    out[o++] = (uint8_t)(v >> 16);
+
+    if (src[i + 2] == '=') {
+        // "xx==" 表示1字节，未使用的位必须为0 / "xx==" encodes 1 byte; unused bits must be zero
+        if (src[i + 3] != '=' || (b & 0x0F) != 0) {
+            return false;
+        }
+    } else {
+        uint32_t c = base64_values[(uint8_t)src[i + 2]];
+        if (c > 63) {
+            return false;
+        }
+        v |= c << 6;
+        out[o++] = (uint8_t)(v >> 8);
+        if (src[i + 3] == '=') {
+            // "xxx=" 表示2字节 / "xxx=" encodes 2 bytes
+            if ((c & 0x03) != 0) {
+                return false;
+            }
+        } else {
+            uint32_t d = base64_values[(uint8_t)src[i + 3]];
+            if (d > 63) {
+                return false;
+            }
+            v |= d;
+            out[o++] = (uint8_t)v;
+        }
+    }
+
+    if (out_len != NULL) {
+        *out_len = o;
+    }
+    return true;
+}
+
+// =====================================================================
+// 十六进制转储 / Hex Dump
+// =====================================================================
+
+// 格式化一行十六进制转储 / Format one hex dump line
+size_t hex_dump_line(char *line, const void *data, size_t len, size_t offset) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    char *p = line;
+
+    if (len > HEX_DUMP_BYTES_PER_LINE) {
+        len = HEX_DUMP_BYTES_PER_LINE;
+    }
+
+    // 8位十六进制偏移 / 8-digit hex offset
+    for (int shift = 28; shift >= 0; shift -= 4) {
+        *p++ = hex_lower[(offset >> shift) & 0x0F];
+    }
+    *p++ = ' ';
+    *p++ = ' ';
+
+    // 十六进制列，第8字节后多一个空格，不足16字节时补空格对齐
+    // Hex columns with an extra gap after byte 8; short lines are padded so the text column aligns
+    for (size_t i = 0; i < HEX_DUMP_BYTES_PER_LINE; i++) {
+        if (i < len) {
+            *p++ = hex_lower[bytes[i] >> 4];
+            *p++ = hex_lower[bytes[i] & 0x0F];
+        } else {
+            *p++ = ' ';
+            *p++ = ' ';
+        }
+        *p++ = ' ';
+        if (i == 7) {
+            *p++ = ' ';
+        }
+    }
+
+    // 可打印字符列 / Printable character column
+    *p++ = ' ';
+    *p++ = '|';
+    for (size_t i = 0; i < len; i++) {
+        *p++ = (bytes[i] >= 0x20 && bytes[i] < 0x7F) ? (char)bytes[i] : '.';
+    }
+    *p++ = '|';
+    *p++ = '\n';
+    *p = '\0';
+    return (size_t)(p - line);
+}
+
+// 十六进制转储到文件 / Hex dump to a file
+void hex_dump(FILE *out, const void *data, size_t len) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    char block[64 * HEX_DUMP_LINE_SIZE];
+    size_t used = 0;
+
+    for (size_t off = 0; off < len; off += HEX_DUMP_BYTES_PER_LINE) {
+        size_t n = len - off < HEX_DUMP_BYTES_PER_LINE ? len - off : HEX_DUMP_BYTES_PER_LINE;
+        if (used + HEX_DUMP_LINE_SIZE > sizeof(block)) {
+            fwrite(block, 1, used, out);
+            used = 0;
+        }
+        used += hex_dump_line(block + used, bytes + off, n, off);
+    }
+    if (used > 0) {
+        fwrite(block, 1, used, out);
+    }
+}
@@ -0,0 +1,103 @@
+/**
+ * 编码转换头文件 / Encoding Codec Header
+ *
+ * 十六进制和Base64（RFC 4648）编解码，以及按行缓冲的十六进制转储
+ * Hex and Base64 (RFC 4648) encode/decode, plus a line-buffered hex dump
+ */
+
+#ifndef CODEC_H
+#define CODEC_H
+
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stdio.h>    // 用于 FILE / For FILE
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 编码n字节所需的缓冲区大小（含'\0'）/ Buffer size to encode n bytes (including '\0')
+#define HEX_ENCODED_SIZE(n)    (2 * (n) + 1)
+#define BASE64_ENCODED_SIZE(n) (((n) + 2) / 3 * 4 + 1)
+
+// 解码n个字符最多产生的字节数 / Maximum bytes produced by decoding n characters
+#define HEX_DECODED_SIZE(n)    ((n) / 2)
+#define BASE64_DECODED_SIZE(n) ((n) / 4 * 3)
+
+// 十六进制转储每行字节数 / Bytes per hex dump line
+#define HEX_DUMP_BYTES_PER_LINE 16
+
+// 一行转储的最大长度（含'\n'和'\0'）/ Maximum length of one dump line (including '\n' and '\0')
+#define HEX_DUMP_LINE_SIZE 80
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 十六进制编码 / Hex encode
+ * @param dst 输出缓冲区，至少HEX_ENCODED_SIZE(len)字节 / Output, at least HEX_ENCODED_SIZE(len) bytes
+ * @param src 输入数据 / Input data
+ * @param len 输入长度 / Input length
+ * @param uppercase true输出A-F，false输出a-f / true for A-F, false for a-f
+ * @return 写入的字符数（不含'\0'）/ Characters written (excluding '\0')
+ */
+size_t hex_encode(char *dst, const void *src, size_t len, bool uppercase);
+
+/**
+ * 十六进制解码（大小写均可）/ Hex decode (either case)
+ * @param dst 输出缓冲区，至少HEX_DECODED_SIZE(len)字节 / Output, at least HEX_DECODED_SIZE(len) bytes
+ * @param src 输入字符 / Input characters
+ * @param len 输入长度 / Input length
+ * @param out_len 解码后的字节数 / Number of decoded bytes
+ * @return 长度为奇数或含非法字符时返回false / false on odd length or an invalid character
+ */
+bool hex_decode(void *dst, const char *src, size_t len, size_t *out_len);
+
+/**
+ * Base64编码（标准字母表，带'='填充）/ Base64 encode (standard alphabet, '=' padded)
+ * @param dst 输出缓冲区，至少BASE64_ENCODED_SIZE(len)字节 / Output, at least BASE64_ENCODED_SIZE(len) bytes
+ * @param src 输入数据 / Input data
+ * @param len 输入长度 / Input length
+ * @return 写入的字符数（不含'\0'）/ Characters written (excluding '\0')
+ */
+size_t base64_encode(char *dst, const void *src, size_t len);
+
+/**
+ * Base64解码（严格：长度为4的倍数，只允许末尾填充）
+ * Base64 decode (strict: length a multiple of 4, padding only at the end)
+ * @param dst 输出缓冲区，至少BASE64_DECODED_SIZE(len)字节 / Output, at least BASE64_DECODED_SIZE(len) bytes
+ * @param src 输入字符 / Input characters
+ * @param len 输入长度 / Input length
+ * @param out_len 解码后的字节数 / Number of decoded bytes
+ * @return 输入无效时返回false / false on invalid input
+ */
+bool base64_decode(void *dst, const char *src, size_t len, size_t *out_len);
+
+/**
+ * 格式化一行十六进制转储 / Format one hex dump line
+ *
+ * 格式与 hexdump -C 相同 / Same format as hexdump -C:
+ *   00000010  48 65 6c 6c 6f 20 57 6f  72 6c 64 0a 00 01 02 03  |Hello World.....|
+ *
+ * @param line 输出缓冲区，至少HEX_DUMP_LINE_SIZE字节 / Output, at least HEX_DUMP_LINE_SIZE bytes
+ * @param data 本行数据 / Data for this line
+ * @param len 本行字节数（最多16）/ Bytes on this line (at most 16)
+ * @param offset 显示的起始偏移 / Offset to display
+ * @return 写入的字符数，含'\n' / Characters written, including '\n'
+ */
+size_t hex_dump_line(char *line, const void *data, size_t len, size_t offset);
+
+/**
+ * 十六进制转储到文件 / Hex dump to a file
+ *
+ * 在本地缓冲区中拼好多行后一次fwrite，而不是每字节一次printf
+ * Builds many lines in a local buffer and issues one fwrite, instead of one printf per byte
+ *
+ * @param out 输出文件 / Output file
+ * @param data 数据 / Data
+ * @param len 数据长度 / Data length
+ */
+void hex_dump(FILE *out, const void *data, size_t len);
+
+#endif // CODEC_H
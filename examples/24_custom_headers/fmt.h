@@ -0,0 +1,125 @@
+/**
+ * 数值格式化头文件 / Number Formatting Header
+ *
+ * 提供不解析格式字符串的快速整数/浮点数格式化，以及只追加的缓冲区格式化器
+ * Provides fast integer/floating-point formatting without format-string parsing,
+ * plus an append-only formatter over a caller-provided buffer
+ */
+
+#ifndef FMT_H
+#define FMT_H
+
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stdint.h>   // 用于 uint64_t, int64_t / For uint64_t, int64_t
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 各函数所需的最小缓冲区大小（含'\0'）/ Minimum buffer sizes (including '\0')
+#define FMT_U64_SIZE    21  // "18446744073709551615"
+#define FMT_I64_SIZE    21  // "-9223372036854775808"
+#define FMT_DOUBLE_SIZE 32  // "-2.2250738585072014e-308" 等 / etc.
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 只追加格式化器 / Append-only formatter
+typedef struct {
+    char *buf;        // 调用者提供的缓冲区 / Caller-provided buffer
+    size_t cap;       // 缓冲区容量 / Buffer capacity
+    size_t len;       // 已写入长度（不含'\0'）/ Bytes written (excluding '\0')
+    bool overflow;    // 是否有内容因空间不足被丢弃 / Whether output was dropped for lack of space
+} fmt_buf_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 格式化无符号64位整数 / Format an unsigned 64-bit integer
+ * @param buf 输出缓冲区，至少FMT_U64_SIZE字节 / Output buffer, at least FMT_U64_SIZE bytes
+ * @param value 数值 / Value
+ * @return 写入的字符数（不含'\0'）/ Characters written (excluding '\0')
+ */
+size_t fmt_u64(char *buf, uint64_t value);
+
+/**
+ * 格式化有符号64位整数 / Format a signed 64-bit integer
+ * @param buf 输出缓冲区，至少FMT_I64_SIZE字节 / Output buffer, at least FMT_I64_SIZE bytes
+ * @param value 数值 / Value
+ * @return 写入的字符数（不含'\0'）/ Characters written (excluding '\0')
+ */
+size_t fmt_i64(char *buf, int64_t value);
+
+/**
+ * 以最短往返形式格式化double / Format a double in shortest round-trip form
+ *
+ * 输出能被解析回完全相同的double的最少位数（Ryu算法）。
+ * 小数点位置在 1e-6 <= |x| < 1e21 时使用定点表示，否则使用科学计数法，
+ * 与JavaScript的Number.prototype.toString规则相同。
+ *
+ * Emits the fewest digits that parse back to the exact same double (Ryu).
+ * Fixed notation is used for 1e-6 <= |x| < 1e21, scientific otherwise,
+ * following JavaScript's Number.prototype.toString rules.
+ *
+ * @param buf 输出缓冲区，至少FMT_DOUBLE_SIZE字节 / Output buffer, at least FMT_DOUBLE_SIZE bytes
+ * @param value 数值 / Value
+ * @return 写入的字符数（不含'\0'）/ Characters written (excluding '\0')
+ */
+size_t fmt_double(char *buf, double value);
+
+/**
+ * 初始化格式化器 / Initialize a formatter
+ * @param f 格式化器 / Formatter
+ * @param buf 输出缓冲区 / Output buffer
+ * @param cap 缓冲区容量（至少1，用于'\0'）/ Buffer capacity (at least 1, for '\0')
+ */
+void fmt_init(fmt_buf_t *f, char *buf, size_t cap);
+
+/**
+ * 追加字符串 / Append a string
+ *
+ * 所有追加函数都是"全有或全无"：放不下时不写入并设置overflow
+ * All append functions are all-or-nothing: if it does not fit, nothing is written and overflow is set
+ *
+ * @param f 格式化器 / Formatter
+ * @param str 字符串 / String
+ * @param len 字符串长度 / String length
+ * @return 成功返回true / true on success
+ */
+bool fmt_append_strn(fmt_buf_t *f, const char *str, size_t len);
+
+/**
+ * 追加以'\0'结尾的字符串 / Append a '\0'-terminated string
+ * @return 成功返回true / true on success
+ */
+bool fmt_append_str(fmt_buf_t *f, const char *str);
+
+/**
+ * 追加单个字符 / Append a single character
+ * @return 成功返回true / true on success
+ */
+bool fmt_append_char(fmt_buf_t *f, char ch);
+
+/**
+ * 追加无符号整数 / Append an unsigned integer
+ * @return 成功返回true / true on success
+ */
+bool fmt_append_u64(fmt_buf_t *f, uint64_t value);
+
+/**
+ * 追加有符号整数 / Append a signed integer
+ * @return 成功返回true / true on success
+ */
+bool fmt_append_i64(fmt_buf_t *f, int64_t value);
+
+/**
+ * 追加最短往返形式的double / Append a double in shortest round-trip form
+ * @return 成功返回true / true on success
+ */
+bool fmt_append_double(fmt_buf_t *f, double value);
+
+#endif // FMT_H
@@ -0,0 +1,93 @@
+/**
+ * 哈希函数头文件 / Hash Function Header
+ *
+ * 提供快速非加密64位哈希和CRC32C校验和
+ * Provides a fast non-cryptographic 64-bit hash and the CRC32C checksum
+ *
+ * 注意：这些函数不能抵抗恶意构造的碰撞，不要用于安全场景
+ * Note: these functions do not resist crafted collisions; do not use them for security
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdint.h>   // 用于 uint32_t, uint64_t / For uint32_t, uint64_t
+#include <stdbool.h>  // 用于 bool / For bool
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 默认种子 / Default seed
+#define HASH_DEFAULT_SEED 0
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 计算64位哈希（wyhash风格）/ Compute a 64-bit hash (wyhash style)
+ *
+ * 短键（<=16字节）只需几次读取和一次128位乘法；长键每轮处理48字节
+ * Short keys (<= 16 bytes) take a few loads and one 128-bit multiply;
+ * long keys are consumed 48 bytes per round
+ *
+ * @param data 数据指针 / Data pointer
+ * @param len 数据长度 / Data length
+ * @param seed 种子 / Seed
+ * @return 64位哈希值 / 64-bit hash value
+ */
+uint64_t hash64(const void *data, size_t len, uint64_t seed);
+
+/**
+ * 忽略ASCII大小写的64位哈希 / 64-bit hash ignoring ASCII case
+ *
+ * 结果等于把'A'-'Z'转成小写后的hash64；折叠在读取时完成，不需要临时缓冲区
+ * Equals hash64 of the data with 'A'-'Z' lowercased; folding happens on load, with no temporary buffer
+ *
+ * @param data 数据指针 / Data pointer
+ * @param len 数据长度 / Data length
+ * @param seed 种子 / Seed
+ * @return 64位哈希值 / 64-bit hash value
+ */
+uint64_t hash64_nocase(const void *data, size_t len, uint64_t seed);
+
+/**
+ * 计算以'\0'结尾字符串的64位哈希 / Compute the 64-bit hash of a '\0'-terminated string
+ * @param str 字符串 / String
+ * @return 64位哈希值 / 64-bit hash value
+ */
+uint64_t hash64_str(const char *str);
+
+/**
+ * 计算CRC32C（Castagnoli多项式）/ Compute CRC32C (Castagnoli polynomial)
+ *
+ * CPU支持SSE4.2时使用crc32指令，否则使用slicing-by-8查表。
+ * 可以分块计算：crc = hash_crc32c(crc, chunk, n)，初始crc为0。
+ *
+ * Uses the SSE4.2 crc32 instruction when available, otherwise slicing-by-8 tables.
+ * Can be computed in chunks: crc = hash_crc32c(crc, chunk, n), starting from crc = 0.
+ *
+ * @param crc 之前的CRC值（首次为0）/ Previous CRC (0 for the first chunk)
+ * @param data 数据指针 / Data pointer
+ * @param len 数据长度 / Data length
+ * @return 更新后的CRC值 / Updated CRC value
+ */
+uint32_t hash_crc32c(uint32_t crc, const void *data, size_t len);
+
+/**
+ * 纯软件CRC32C（slicing-by-8）/ Software-only CRC32C (slicing-by-8)
+ *
+ * 结果与hash_crc32c相同，用于对比和测试
+ * Same result as hash_crc32c; useful for comparison and testing
+ */
+uint32_t hash_crc32c_sw(uint32_t crc, const void *data, size_t len);
+
+/**
+ * 检查是否可以使用硬件CRC32C / Check whether hardware CRC32C is available
+ * @return true如果CPU支持SSE4.2 / true if the CPU supports SSE4.2
+ */
+bool hash_crc32c_hw_available(void);
+
+#endif // HASH_H
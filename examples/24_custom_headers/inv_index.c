@@ -0,0 +1,482 @@
+/**
+ * 倒排索引实现文件 / Inverted Index Implementation
+ *
+ * 建立分两步 / Building takes two steps:
+ *   1. 扫描文本，词表（线性探测）给每个词分配ID，把行号追加到该词的临时数组（同一行只记一次）
+ *      Scan the text; the term table (linear probing) gives each term an ID and the line number is
+ *      appended to that term's temporary array (once per line)
+ *   2. 把临时数组压缩成一块连续的postings：相邻行号之差用LEB128变长编码，常见词的差值多为1字节
+ *      Compress the temporary arrays into one contiguous postings buffer: gaps between line numbers are
+ *      LEB128 varints, mostly one byte for common terms
+ *
+ * 查询时解码要用的列表（解码到最后一个候选为止），按长度从短到长求交集。
+ * Queries decode the lists they need (up to the last candidate) and intersect them from shortest to longest.
+ */
+
+#include "inv_index.h"
+#include "string_utils.h"  // 用于 STR_IS_SPACE, str_ihash, str_ieq_n, str_to_lower_a / For STR_IS_SPACE, str_ihash, str_ieq_n, str_to_lower_a
+#include <stdlib.h>   // 用于 malloc, calloc, realloc, free / For malloc, calloc, realloc, free
+#include <string.h>   // 用于 memcpy, strlen / For memcpy, strlen
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>  // 用于 SSE2 / For SSE2
+#endif
+
+// 词表的初始槽数 / Initial slots of the term table
+#define INV_INITIAL_CAPACITY 1024
+
+// 长度比超过此值时改用倍增查找 / Switch to galloping beyond this length ratio
+#define INV_GALLOP_RATIO 32
+
+// 建立期间一个词的行号数组 / A term's line numbers during the build
+typedef struct {
+    uint32_t *docs;
+    uint32_t count;
+    uint32_t capacity;
+} inv_list_t;
+
+// =====================================================================
+// 词表 / Term Table
+// =====================================================================
+
+// 查找词，返回槽下标；不存在时返回空槽的下标
+// Find a term and return its slot index; an empty slot's index when absent
+static size_t find_slot(const inv_index_t *index, const char *term, size_t len, uint64_t hash) {
+    size_t mask = index->capacity - 1;
+    size_t i = (size_t)hash & mask;
+    while (index->slots[i].term != NULL) {
+        const inv_term_slot_t *slot = &index->slots[i];
+        if (slot->hash == hash && slot->len == len && str_ieq_n(slot->term, term, len)) {
+            return i;
+        }
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+static bool grow_table(inv_index_t *index) {
+    size_t capacity = index->capacity * 2;
+    inv_term_slot_t *slots = calloc(capacity, sizeof(inv_term_slot_t));
+    if (slots == NULL) {
+        return false;
+    }
+    size_t mask = capacity - 1;
+    for (size_t i = 0; i < index->capacity; i++) {
+        if (index->slots[i].term != NULL) {
+            size_t j = (size_t)index->slots[i].hash & mask;
+            while (slots[j].term != NULL) {
+                j = (j + 1) & mask;
+            }
+            slots[j] = index->slots[i];
+        }
+    }
+    free(index->slots);
+    index->slots = slots;
+    index->capacity = capacity;
+    return true;
+}
+
+// 把行号doc记到词上（同一行重复出现只记一次）/ Record line doc for a term (once per line)
+static bool add_term(inv_index_t *index, inv_list_t **lists, size_t *lists_capacity,
+                     const char *term, size_t len, uint32_t doc) {
+    if (len > UINT32_MAX) {
+        return false;
+    }
+    uint64_t hash = str_ihash(term, len);
+    size_t i = find_slot(index, term, len, hash);
+    inv_term_slot_t *slot = &index->slots[i];
+    if (slot->term == NULL) {
+        if (index->num_terms == *lists_capacity) {
+            size_t capacity = *lists_capacity * 2;
+            inv_list_t *grown = realloc(*lists, capacity * sizeof(inv_list_t));
+            if (grown == NULL) {
+                return false;
+            }
+            memset(grown + *lists_capacity, 0, (capacity - *lists_capacity) * sizeof(inv_list_t));
+            *lists = grown;
+            *lists_capacity = capacity;
+        }
+        char *copy = str_to_lower_a(&index->arena, (str_view_t){ term, len });
+        if (copy == NULL) {
+            return false;
+        }
+        slot->term = copy;
+        slot->len = (uint32_t)len;
+        slot->id = (uint32_t)index->num_terms++;
+        slot->hash = hash;
+    }
+
+    inv_list_t *list = &(*lists)[slot->id];
+    if (list->count > 0 && list->docs[list->count - 1] == doc) {
+        return true;
+    }
+    if (list->count == list->capacity) {
+        uint32_t capacity = list->capacity == 0 ? 4 : list->capacity * 2;
+        uint32_t *docs = realloc(list->docs, capacity * sizeof(uint32_t));
+        if (docs == NULL) {
+            return false;
+        }
+        list->docs = docs;
+        list->capacity = capacity;
+    }
+    list->docs[list->count++] = doc;
+
+    // 插入之后保持负载不超过1/2 / Keep the load at or below 1/2 after inserting
+    if (index->num_terms * 2 > index->capacity) {
+        return grow_table(index);
+    }
+    return true;
+}
+
+// =====================================================================
+// 变长编码 / Varints
+// =====================================================================
+
+static size_t varint_size(uint32_t value) {
+    size_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+static unsigned char* varint_put(unsigned char *p, uint32_t value) {
+    while (value >= 0x80) {
+        *p++ = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    *p++ = (unsigned char)value;
+    return p;
+}
+
+// 解码一个词的列表，超过limit就停止，返回解码的个数
+// Decode one term's list, stopping past limit; returns the number decoded
+static size_t decode_list(const inv_index_t *index, uint32_t id, uint32_t limit, uint32_t *out) {
+    const unsigned char *p = index->postings + index->offsets[id];
+    uint32_t count = index->doc_freqs[id];
+    uint32_t doc = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t delta = 0;
+        int shift = 0;
+        unsigned char byte;
+        do {
+            byte = *p++;
+            delta |= (uint32_t)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        doc += delta;
+        if (doc > limit) {
+            return i;
+        }
+        out[i] = doc;
+    }
+    return count;
+}
+
+// =====================================================================
+// 建立 / Build
+// =====================================================================
+
+// 把临时数组压缩进postings / Compress the temporary arrays into postings
+static bool compress_lists(inv_index_t *index, const inv_list_t *lists) {
+    size_t n = index->num_terms > 0 ? index->num_terms : 1;
+    index->offsets = malloc(n * sizeof(size_t));
+    index->doc_freqs = malloc(n * sizeof(uint32_t));
+    if (index->offsets == NULL || index->doc_freqs == NULL) {
+        return false;
+    }
+
+    size_t total = 0;
+    for (size_t t = 0; t < index->num_terms; t++) {
+        uint32_t prev = 0;
+        for (uint32_t i = 0; i < lists[t].count; i++) {
+            total += varint_size(lists[t].docs[i] - prev);
+            prev = lists[t].docs[i];
+        }
+    }
+    index->postings = malloc(total > 0 ? total : 1);
+    if (index->postings == NULL) {
+        return false;
+    }
+
+    unsigned char *p = index->postings;
+    for (size_t t = 0; t < index->num_terms; t++) {
+        index->offsets[t] = (size_t)(p - index->postings);
+        index->doc_freqs[t] = lists[t].count;
+        uint32_t prev = 0;
+        for (uint32_t i = 0; i < lists[t].count; i++) {
+            p = varint_put(p, lists[t].docs[i] - prev);
+            prev = lists[t].docs[i];
+        }
+    }
+    index->postings_size = total;
+    return true;
+}
+
+bool inv_index_build(inv_index_t *index, const char *text, size_t len) {
+    memset(index, 0, sizeof(*index));
+    arena_init(&index->arena, 0);
+    index->capacity = INV_INITIAL_CAPACITY;
+    index->slots = calloc(index->capacity, sizeof(inv_term_slot_t));
+    size_t lists_capacity = INV_INITIAL_CAPACITY;
+    inv_list_t *lists = calloc(lists_capacity, sizeof(inv_list_t));
+    bool ok = index->slots != NULL && lists != NULL;
+
+    uint32_t doc = 0;
+    bool line_open = false;   // 当前行有内容 / The current line has content
+    size_t i = 0;
+    while (ok && i < len) {
+        unsigned char c = (unsigned char)text[i];
+        if (STR_IS_SPACE(c)) {
+            if (c == '\n') {
+                if (doc == UINT32_MAX) {
+                    ok = false;
+                    break;
+                }
+                doc++;
+                line_open = false;
+            }
+            i++;
+            continue;
+        }
+        size_t start = i;
+        while (i < len && !STR_IS_SPACE(text[i])) {
+            i++;
+        }
+        line_open = true;
+        ok = add_term(index, &lists, &lists_capacity, text + start, i - start, doc);
+    }
+    // 最后一行没有换行符时也算一个文档 / A final line without a newline still counts as a document
+    index->num_docs = doc + (line_open ? 1 : 0);
+
+    if (ok) {
+        ok = compress_lists(index, lists);
+    }
+    if (lists != NULL) {
+        for (size_t t = 0; t < index->num_terms; t++) {
+            free(lists[t].docs);
+        }
+        free(lists);
+    }
+    if (!ok) {
+        inv_index_free(index);
+    }
+    return ok;
+}
+
+// =====================================================================
+// 求交集 / Intersection
+// =====================================================================
+
+// 在严格递增的b[j..nb)中找第一个>=x的位置：先倍增步长，再二分
+// Find the first position >= x in the strictly increasing b[j..nb): double the step, then binary search
+static size_t gallop(const uint32_t *b, size_t j, size_t nb, uint32_t x) {
+    size_t step = 1;
+    size_t lo = j, hi = j;
+    while (hi < nb && b[hi] < x) {
+        lo = hi + 1;
+        hi += step;
+        step *= 2;
+    }
+    if (hi > nb) {
+        hi = nb;
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (b[mid] < x) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// 短数组的每个元素在长数组中倍增查找 / Gallop through the long array for each element of the short one
+static size_t intersect_gallop(const uint32_t *small, size_t ns, const uint32_t *large, size_t nl,
+                               uint32_t *out) {
+    size_t k = 0, j = 0;
+    for (size_t i = 0; i < ns && j < nl; i++) {
+        j = gallop(large, j, nl, small[i]);
+        if (j < nl && large[j] == small[i]) {
+            out[k++] = small[i];
+            j++;
+        }
+    }
+    return k;
+}
+
+// 普通归并 / Plain merge
+static size_t intersect_merge(const uint32_t *a, size_t na, const uint32_t *b, size_t nb,
+                              size_t i, size_t j, uint32_t *out, size_t k) {
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (a[i] > b[j]) {
+            j++;
+        } else {
+            out[k++] = a[i];
+            i++;
+            j++;
+        }
+    }
+    return k;
+}
+
+#if defined(__SSE2__)
+// 每次取a、b各4个元素，把b轮转3次与a逐一比较，得到a中哪些元素在b块里；
+// 再比较两个块的最大值，推进较小的一方（相等时都推进）
+// Take 4 elements of a and of b, compare a against b and its 3 rotations to find which elements of a
+// occur in the b block; then advance whichever block has the smaller maximum (both when equal)
+static size_t intersect_sse2(const uint32_t *a, size_t na, const uint32_t *b, size_t nb,
+                             uint32_t *out) {
+    size_t i = 0, j = 0, k = 0;
+    size_t limit = na < nb ? na : nb;   // out的容量 / Capacity of out
+    while (i + 4 <= na && j + 4 <= nb) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + j));
+        __m128i eq = _mm_cmpeq_epi32(va, vb);
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (k + 4 <= limit) {
+            // 无分支写出：每个元素都写，只有匹配的才推进k
+            // Branch-free output: write every element but only advance k on a match
+            out[k] = a[i];
+            k += (size_t)(mask & 1);
+            out[k] = a[i + 1];
+            k += (size_t)((mask >> 1) & 1);
+            out[k] = a[i + 2];
+            k += (size_t)((mask >> 2) & 1);
+            out[k] = a[i + 3];
+            k += (size_t)((mask >> 3) & 1);
+        } else {
+            // 接近out末尾时只写匹配的元素 / Near the end of out only matches are written
+            for (int lane = 0; lane < 4; lane++) {
+                if (mask & (1 << lane)) {
+                    out[k++] = a[i + (size_t)lane];
+                }
+            }
+        }
+        uint32_t max_a = a[i + 3], max_b = b[j + 3];
+        i += max_a <= max_b ? 4 : 0;
+        j += max_b <= max_a ? 4 : 0;
+    }
+    return intersect_merge(a, na, b, nb, i, j, out, k);
+}
+#endif
+
+size_t inv_intersect(const uint32_t *a, size_t na, const uint32_t *b, size_t nb, uint32_t *out) {
+    if (na == 0 || nb == 0) {
+        return 0;
+    }
+    if (na / INV_GALLOP_RATIO > nb) {
+        return intersect_gallop(b, nb, a, na, out);
+    }
+    if (nb / INV_GALLOP_RATIO > na) {
+        return intersect_gallop(a, na, b, nb, out);
+    }
+#if defined(__SSE2__)
+    return intersect_sse2(a, na, b, nb, out);
+#else
+    return intersect_merge(a, na, b, nb, 0, 0, out, 0);
+#endif
+}
+
+// =====================================================================
+// 查询 / Queries
+// =====================================================================
+
+// 词ID，不存在返回UINT32_MAX / Term ID, UINT32_MAX when absent
+static uint32_t term_id(const inv_index_t *index, const char *term, size_t len) {
+    if (index->slots == NULL) {
+        return UINT32_MAX;
+    }
+    size_t i = find_slot(index, term, len, str_ihash(term, len));
+    return index->slots[i].term != NULL ? index->slots[i].id : UINT32_MAX;
+}
+
+uint32_t inv_index_doc_freq(const inv_index_t *index, const char *term, size_t len) {
+    uint32_t id = term_id(index, term, len);
+    return id != UINT32_MAX ? index->doc_freqs[id] : 0;
+}
+
+size_t inv_index_and(const inv_index_t *index, const char *const *terms, size_t num_terms,
+                     uint32_t *out, size_t max_out) {
+    if (num_terms == 0) {
+        return 0;
+    }
+    uint32_t *ids = malloc(num_terms * sizeof(uint32_t));
+    if (ids == NULL) {
+        return INV_INDEX_ERROR;
+    }
+    // 任何一个词不存在，结果就为空 / If any term is missing the result is empty
+    for (size_t t = 0; t < num_terms; t++) {
+        ids[t] = term_id(index, terms[t], strlen(terms[t]));
+        if (ids[t] == UINT32_MAX) {
+            free(ids);
+            return 0;
+        }
+    }
+    // 按文档数升序（词数很少，插入排序）/ Ascending by document count (few terms, insertion sort)
+    uint32_t longest = 0;
+    for (size_t t = 0; t < num_terms; t++) {
+        uint32_t id = ids[t];
+        size_t s = t;
+        while (s > 0 && index->doc_freqs[ids[s - 1]] > index->doc_freqs[id]) {
+            ids[s] = ids[s - 1];
+            s--;
+        }
+        ids[s] = id;
+        if (index->doc_freqs[id] > longest) {
+            longest = index->doc_freqs[id];
+        }
+    }
+
+    // 候选集合在两个缓冲区之间交替，第三个缓冲区存放解码的列表
+    // Candidates alternate between two buffers; a third holds the decoded list
+    size_t shortest = index->doc_freqs[ids[0]];
+    uint32_t *candidates = malloc(shortest * sizeof(uint32_t));
+    uint32_t *next = malloc(shortest * sizeof(uint32_t));
+    uint32_t *decoded = malloc((size_t)longest * sizeof(uint32_t));
+    size_t count = INV_INDEX_ERROR;
+    if (candidates != NULL && next != NULL && decoded != NULL) {
+        count = decode_list(index, ids[0], UINT32_MAX, candidates);
+        for (size_t t = 1; t < num_terms && count > 0; t++) {
+            // 大于最后一个候选的部分不必解码 / Nothing past the last candidate needs decoding
+            size_t n = decode_list(index, ids[t], candidates[count - 1], decoded);
+            count = inv_intersect(candidates, count, decoded, n, next);
+            uint32_t *swap = candidates;
+            candidates = next;
+            next = swap;
+        }
+        memcpy(out, candidates, (count < max_out ? count : max_out) * sizeof(uint32_t));
+    }
+    free(candidates);
+    free(next);
+    free(decoded);
+    free(ids);
+    return count;
+}
+
+// =====================================================================
+// 内存 / Memory
+// =====================================================================
+
+size_t inv_index_memory(const inv_index_t *index) {
+    return index->arena.reserved
+         + index->capacity * sizeof(inv_term_slot_t)
+         + index->num_terms * (sizeof(size_t) + sizeof(uint32_t))
+         + index->postings_size;
+}
+
+void inv_index_free(inv_index_t *index) {
+    arena_free(&index->arena);
+    free(index->slots);
+    free(index->offsets);
+    free(index->doc_freqs);
+    free(index->postings);
+    memset(index, 0, sizeof(*index));
+}
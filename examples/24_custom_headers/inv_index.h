@@ -0,0 +1,126 @@
+/**
+ * 倒排索引头文件 / Inverted Index Header
+ *
+ * 按行建立索引：每个词对应包含它的行号（文档ID）列表，列表按差值变长编码压缩；
+ * AND查询对列表求交集，长度悬殊时用倍增查找，长度相近时用SIMD分块比较
+ * Indexes text line by line: each term maps to the line numbers (document IDs) containing it, stored
+ * as delta-encoded varints; AND queries intersect the lists, galloping when the lengths differ a lot
+ * and comparing SIMD blocks when they are similar
+ */
+
+#ifndef INV_INDEX_H
+#define INV_INDEX_H
+
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdint.h>   // 用于 uint32_t, SIZE_MAX / For uint32_t, SIZE_MAX
+#include "arena.h"    // 用于 arena_t / For arena_t
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 查询出错（内存不足）/ Query failed (out of memory)
+#define INV_INDEX_ERROR SIZE_MAX
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 词表的一个槽 / One slot of the term table
+typedef struct {
+    const char *term;       // 小写的词，NULL表示空槽 / Lowercased term, NULL for an empty slot
+    uint32_t len;           // 词长度 / Term length
+    uint32_t id;            // 词ID / Term ID
+    uint64_t hash;          // 忽略大小写的哈希 / Case-insensitive hash
+} inv_term_slot_t;
+
+// 倒排索引 / Inverted index
+typedef struct {
+    arena_t arena;          // 词的存储 / Term storage
+    inv_term_slot_t *slots; // 词表（开放寻址）/ Term table (open addressing)
+    size_t capacity;        // 槽数（2的幂）/ Number of slots (a power of two)
+    size_t num_terms;       // 不同词数 / Number of distinct terms
+    uint32_t num_docs;      // 文档（行）数 / Number of documents (lines)
+    size_t *offsets;        // 每个词的列表在postings中的偏移 / Offset of each term's list in postings
+    uint32_t *doc_freqs;    // 每个词出现的文档数 / Number of documents containing each term
+    unsigned char *postings;// 差值变长编码的列表 / Delta-encoded varint lists
+    size_t postings_size;   // postings的字节数 / Bytes in postings
+} inv_index_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 为文本建立索引（每行一个文档）/ Index a text (one document per line)
+ *
+ * 词是空白（STR_IS_SPACE）分隔的字节序列，忽略ASCII大小写；
+ * 索引保存词的副本，建立之后不再需要text
+ * Terms are runs of bytes separated by whitespace (STR_IS_SPACE), ignoring ASCII case;
+ * the index keeps copies of the terms, so text is not needed afterwards
+ *
+ * @param index 索引 / Index
+ * @param text 文本 / Text
+ * @param len 文本长度 / Text length
+ * @return 成功返回true，内存不足或超过UINT32_MAX行返回false
+ *         true on success, false when out of memory or beyond UINT32_MAX lines
+ */
+bool inv_index_build(inv_index_t *index, const char *text, size_t len);
+
+/**
+ * 包含某个词的文档数 / Number of documents containing a term
+ * @param index 索引 / Index
+ * @param term 词 / Term
+ * @param len 词长度 / Term length
+ * @return 文档数，词不存在返回0 / Number of documents, 0 for an unknown term
+ */
+uint32_t inv_index_doc_freq(const inv_index_t *index, const char *term, size_t len);
+
+/**
+ * AND查询：同时包含所有词的文档 / AND query: documents containing every term
+ *
+ * 先解码最短的列表，再按长度从短到长依次求交集，候选集合只会越来越小
+ * Decodes the shortest list first and intersects from shortest to longest, so the candidate set only shrinks
+ *
+ * @param index 索引 / Index
+ * @param terms 词（以'\0'结尾）/ Terms ('\0'-terminated)
+ * @param num_terms 词数 / Number of terms
+ * @param out 输出：升序文档ID / Output: ascending document IDs
+ * @param max_out out的容量 / Capacity of out
+ * @return 匹配的文档总数（可能大于max_out），内存不足返回INV_INDEX_ERROR
+ *         Total matching documents (may exceed max_out), or INV_INDEX_ERROR when out of memory
+ */
+size_t inv_index_and(const inv_index_t *index, const char *const *terms, size_t num_terms,
+                     uint32_t *out, size_t max_out);
+
+/**
+ * 求两个严格递增数组的交集 / Intersect two strictly increasing arrays
+ *
+ * 长度相差32倍以上时对长数组倍增查找，否则用SSE2每次比较4×4个元素；out不能与输入重叠
+ * Gallops through the longer array when the lengths differ by more than 32x, otherwise compares 4x4
+ * elements at a time with SSE2; out must not overlap the inputs
+ *
+ * @param a 第一个数组 / First array
+ * @param na a的长度 / Length of a
+ * @param b 第二个数组 / Second array
+ * @param nb b的长度 / Length of b
+ * @param out 输出（至少min(na, nb)项）/ Output (at least min(na, nb) entries)
+ * @return 交集大小 / Size of the intersection
+ */
+size_t inv_intersect(const uint32_t *a, size_t na, const uint32_t *b, size_t nb, uint32_t *out);
+
+/**
+ * 索引占用的内存 / Memory used by the index
+ * @param index 索引 / Index
+ * @return 字节数 / Number of bytes
+ */
+size_t inv_index_memory(const inv_index_t *index);
+
+/**
+ * 释放索引 / Free an index
+ * @param index 索引 / Index
+ */
+void inv_index_free(inv_index_t *index);
+
+#endif // INV_INDEX_H
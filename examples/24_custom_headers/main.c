@@ -5,13 +5,33 @@
  * This example demonstrates how to create and use custom header files
  * 
  * 编译方法 / Compilation:
- *   gcc -Wall -Wextra -std=c11 -o custom_headers main.c utils.c string_utils.c
+ *   gcc -Wall -Wextra -std=c11 -O2 -o custom_headers main.c utils.c arena.c string_utils.c str_parse.c fmt.c hash.c codec.c str_distance.c str_glob.c str_intern.c str_builder.c str_sort.c str_dict.c word_freq.c inv_index.c cdc.c utils_generic.c tdigest.c window.c -pthread -lm
  *   或使用Makefile: make
  */
 
 #include <stdio.h>
+#include <stdlib.h>        // 用于 free / For free
+#include <string.h>        // 用于 strlen / For strlen
+#include <stdint.h>        // 用于 INT64_MIN / For INT64_MIN
 #include "utils.h"         // 包含自定义头文件 / Include custom header
+#include "utils_generic.h" // 类型泛型数组函数 / Type-generic array functions
+#include "arena.h"         // 内存区域分配器 / Arena allocator
 #include "string_utils.h"  // 包含另一个自定义头文件 / Include another custom header
+#include "str_parse.h"     // 数值解析 / Number parsing
+#include "fmt.h"           // 数值格式化 / Number formatting
+#include "hash.h"          // 哈希函数 / Hash functions
+#include "codec.h"         // 十六进制/Base64编码 / Hex/Base64 encoding
+#include "str_distance.h"  // 编辑距离 / Edit distance
+#include "str_glob.h"      // 通配符匹配 / Glob matching
+#include "str_intern.h"    // 字符串驻留 / String interning
+#include "str_builder.h"   // 字符串构建器 / String builder
+#include "str_sort.h"      // 字符串排序 / String sorting
+#include "str_dict.h"      // 前缀压缩字典 / Front-coded dictionary
+#include "word_freq.h"     // 词频统计 / Word frequency
+#include "inv_index.h"     // 倒排索引 / Inverted index
+#include "cdc.h"           // 内容定义分块 / Content-defined chunking
+#include "tdigest.h"       // 分位数草图 / Quantile sketch
+#include "window.h"        // 滑动窗口聚合 / Sliding-window aggregates
 
 // =====================================================================
 // 辅助函数 / Helper Functions
@@ -95,13 +115,65 @@ int main(void) {
     if (status == UTILS_SUCCESS) {
         printf("  utils_array_min() = %d\n", min_val);
     }
-    
+
+    // 一次遍历得到全部统计量 / Every statistic in one pass
+    utils_stats_t stats;
+    if (utils_array_stats(numbers, size, &stats) == UTILS_SUCCESS) {
+        printf("  utils_array_stats() = sum %lld, min %d, max %d, mean %.2f, variance %.2f\n",
+               stats.sum, stats.min, stats.max, stats.mean, stats.variance);
+    }
+    // 两半分别累加再合并，与整体一致 / Accumulate two halves separately and merge, matching the whole array
+    utils_accum_t first_half, second_half;
+    utils_accum_init(&first_half);
+    utils_accum_init(&second_half);
+    utils_accum_add_array(&first_half, numbers, size / 2);
+    for (size_t i = size / 2; i < size; i++) {
+        utils_accum_add(&second_half, numbers[i]);
+    }
+    utils_accum_merge(&first_half, &second_half);
+    printf("  utils_accum_merge() = count %llu, mean %.2f, variance %.2f\n",
+           first_half.count, first_half.mean, utils_accum_variance(&first_half));
+    // 小数组不会建线程 / Small arrays never start threads
+    printf("  utils_array_sum_parallel(..., 0) = %lld (%d 个核 / cores)\n",
+           utils_array_sum_parallel(numbers, size, 0), utils_cpu_count());
+    // 不排序取最大的3个和中位数；utils_array_nth会重排数组，所以用副本
+    // The 3 largest and the median without sorting; utils_array_nth reorders the array, so it gets a copy
+    int top[3];
+    if (utils_array_topk(numbers, size, 3, top) == UTILS_SUCCESS) {
+        print_array("utils_array_topk(..., 3)", top, 3);
+    }
+    int scratch[UTILS_ARRAY_LEN(numbers)];
+    memcpy(scratch, numbers, sizeof(numbers));
+    int median;
+    if (utils_array_nth(scratch, size, size / 2, &median) == UTILS_SUCCESS) {
+        printf("  utils_array_nth(..., size / 2) = %d (中位数 / median)\n", median);
+    }
+
     // 反转数组 / Reverse array
     int arr_copy[] = {1, 2, 3, 4, 5};
     size_t copy_size = UTILS_ARRAY_LEN(arr_copy);
     print_array("反转前 / Before reverse", arr_copy, copy_size);
     utils_array_reverse(arr_copy, copy_size);
     print_array("反转后 / After reverse", arr_copy, copy_size);
+    utils_array_rotate(arr_copy, copy_size, 2);
+    print_array("左移2位 / Rotated left by 2", arr_copy, copy_size);
+
+    // 类型泛型数组函数：_Generic按指针类型选函数 / Type-generic array functions: _Generic picks by pointer type
+    printf("\n[类型泛型数组函数 / Type-Generic Array Functions]\n");
+    uint8_t pixels[] = {12, 200, 37, 255, 0, 91};
+    float readings[] = {0.5f, -1.25f, 3.0f, 2.75f};
+    uint8_t brightest = 0;
+    UTILS_ARRAY_MAX(pixels, UTILS_ARRAY_LEN(pixels), &brightest);
+    printf("  UTILS_ARRAY_SUM(uint8_t[]) = %llu, UTILS_ARRAY_MAX = %u\n",
+           (unsigned long long)UTILS_ARRAY_SUM(pixels, UTILS_ARRAY_LEN(pixels)), brightest);
+    utils_stats_f32_t sample_stats;
+    if (UTILS_ARRAY_STATS(readings, UTILS_ARRAY_LEN(readings), &sample_stats) == UTILS_SUCCESS) {
+        printf("  UTILS_ARRAY_STATS(float[]) = sum %.2f, min %.2f, max %.2f, mean %.4f, variance %.4f\n",
+               sample_stats.sum, sample_stats.min, sample_stats.max, sample_stats.mean, sample_stats.variance);
+    }
+    UTILS_ARRAY_REVERSE(readings, UTILS_ARRAY_LEN(readings));
+    printf("  UTILS_ARRAY_REVERSE(float[]) = {%.2f, %.2f, %.2f, %.2f}\n",
+           readings[0], readings[1], readings[2], readings[3]);
     
     // 类型定义 / Type definitions
     printf("\n[自定义类型 / Custom Types]\n");
@@ -122,7 +194,15 @@ int main(void) {
     status = utils_array_max(NULL, 5, &result);  // 传入空指针 / Pass null pointer
     printf("  utils_array_max(NULL, ...) 返回 / returned: %s\n", 
            utils_status_message(status));
-    
+    // 紧凑返回值：值和状态码在一个寄存器里，出错细节在线程局部的错误上下文中
+    // Compact return: value and status in one register, error details in the thread-local error context
+    utils_value_t largest = utils_array_max_value(numbers, size);
+    printf("  utils_array_max_value() = {value %d, status %d}\n", largest.value, largest.status);
+    utils_value_t nth = utils_array_nth_value(scratch, size, 12);
+    if (nth.status != UTILS_SUCCESS) {
+        printf("  utils_array_nth_value(..., 12) 失败 / failed: %s\n", utils_last_error_message());
+    }
+
     // 字符串检查 / String check
     printf("\n[字符串检查 / String Check]\n");
     printf("  utils_string_is_empty(NULL) = %s\n", 
@@ -193,11 +273,566 @@ int main(void) {
            str_is_alpha("Hello") ? "true" : "false");
     printf("  str_is_alpha(\"Hello123\") = %s\n", 
            str_is_alpha("Hello123") ? "true" : "false");
+
+    // 忽略大小写：用户输入的名字作为查找键 / Case-insensitive: user-entered names as lookup keys
+    printf("\n[忽略大小写 / Case-Insensitive]\n");
+    const char *stored_name = "Zhang San";
+    const char *typed_name = "ZHANG san";
+    size_t name_len = strlen(stored_name);
+    printf("  str_ieq_n(\"%s\", \"%s\") = %s\n", stored_name, typed_name,
+           str_ieq_n(stored_name, typed_name, name_len) ? "true" : "false");
+    printf("  str_icmp_n(\"apple\", \"BANANA\", 5) = %d\n", str_icmp_n("apple", "BANANA", 5));
+    printf("  str_ihash(\"%s\") == str_ihash(\"%s\"): %s\n", stored_name, typed_name,
+           str_ihash(stored_name, name_len) == str_ihash(typed_name, name_len) ? "true" : "false");
     
     // =====================================================================
-    // 3. 总结 / Summary
+    // 3. str_parse.h 示例 / str_parse.h Examples
+    // =====================================================================
+    print_section("3. str_parse.h - 数值解析 / Number Parsing");
+
+    // 按长度解析字段，返回值指向数字之后 / Parse by length; return value points past the number
+    printf("\n[成绩字段解析 / Score Field Parsing]\n");
+    const char *scores = "85.5 92.25 7.8e1 -0.5";
+    printf("  输入 / Input: \"%s\"\n", scores);
+    const char *cursor = scores;
+    const char *scores_end = scores + strlen(scores);
+    while (cursor < scores_end) {
+        double score;
+        const char *next = str_parse_double(cursor, (size_t)(scores_end - cursor), &score);
+        if (next == NULL) {
+            break;
+        }
+        printf("  str_parse_double() = %g (消耗 / consumed %d 字节 / bytes)\n",
+               score, (int)(next - cursor));
+        cursor = (next < scores_end && *next == ' ') ? next + 1 : next;
+    }
+
+    // 长度限制：只解析前3个字节 / Length limit: only the first 3 bytes are parsed
+    double limited;
+    str_parse_double("12345", 3, &limited);
+    printf("  str_parse_double(\"12345\", 3) = %g\n", limited);
+
+    // 正确舍入：恰好位于两个double之间的值向偶数舍入
+    // Correct rounding: a value exactly between two doubles rounds to even
+    double halfway;
+    const char *halfway_text = "9007199254740993";  // 2^53 + 1
+    str_parse_double(halfway_text, strlen(halfway_text), &halfway);
+    printf("  str_parse_double(\"%s\") = %.0f\n", halfway_text, halfway);
+
+    // 整数部分超过800位：走精确回退路径，丢掉的位仍要计入小数点位置
+    // More than 800 integer digits: the exact fallback still counts the dropped digits into the point
+    static char huge_text[900];
+    size_t huge_len = 0;
+    huge_text[huge_len++] = '1';
+    memset(huge_text + huge_len, '0', 809);
+    huge_len += 809;
+    memcpy(huge_text + huge_len, "1e-810", 6);
+    huge_len += 6;
+    double huge_value;
+    str_parse_double(huge_text, huge_len, &huge_value);
+    printf("  str_parse_double(\"1\" + 809个0 / zeros + \"1e-810\") = %.17g (strtod: %.17g)\n",
+           huge_value, strtod(huge_text, NULL));
+    huge_len = strlen(halfway_text);
+    memcpy(huge_text, halfway_text, huge_len);
+    memset(huge_text + huge_len, '0', 834);
+    huge_len += 834;
+    memcpy(huge_text + huge_len, "e-834", 5);
+    huge_len += 5;
+    huge_text[huge_len] = '\0';
+    str_parse_double(huge_text, huge_len, &huge_value);
+    printf("  str_parse_double(\"%s\" + 834个0 / zeros + \"e-834\") = %.17g (strtod: %.17g)\n",
+           halfway_text, huge_value, strtod(huge_text, NULL));
+
+    // 无效输入返回NULL / Invalid input returns NULL
+    double invalid;
+    printf("  str_parse_double(\"abc\") 返回 / returned %s\n",
+           str_parse_double("abc", 3, &invalid) == NULL ? "NULL" : "non-NULL");
+
+    // =====================================================================
+    // 4. fmt.h 示例 / fmt.h Examples
+    // =====================================================================
+    print_section("4. fmt.h - 数值格式化 / Number Formatting");
+
+    // 整数格式化 / Integer formatting
+    printf("\n[整数 / Integers]\n");
+    char num_buf[FMT_DOUBLE_SIZE];
+    fmt_u64(num_buf, 18446744073709551615ULL);
+    printf("  fmt_u64(UINT64_MAX) = \"%s\"\n", num_buf);
+    fmt_i64(num_buf, INT64_MIN);
+    printf("  fmt_i64(INT64_MIN)  = \"%s\"\n", num_buf);
+
+    // 最短往返：0.1不会被打印成0.10000000000000001
+    // Shortest round-trip: 0.1 is not printed as 0.10000000000000001
+    printf("\n[最短往返浮点数 / Shortest Round-Trip Doubles]\n");
+    const double samples[] = {0.1, 85.5, 1.0 / 3.0, 1e21, 5e-324, -0.0};
+    for (size_t i = 0; i < UTILS_ARRAY_LEN(samples); i++) {
+        fmt_double(num_buf, samples[i]);
+        printf("  %%.17g = %-24.17g fmt_double = \"%s\"\n", samples[i], num_buf);
+    }
+
+    // 只追加格式化器：不解析格式字符串，空间不足时整项丢弃
+    // Append-only formatter: no format string; an item that does not fit is dropped whole
+    printf("\n[只追加格式化器 / Append-Only Formatter]\n");
+    char line[48];
+    fmt_buf_t out;
+    fmt_init(&out, line, sizeof(line));
+    fmt_append_str(&out, "id=");
+    fmt_append_u64(&out, 1001);
+    fmt_append_str(&out, " name=Alice score=");
+    fmt_append_double(&out, 85.5);
+    printf("  \"%s\" (len=%zu, overflow=%s)\n", line, out.len, out.overflow ? "true" : "false");
+    fmt_append_str(&out, " comment=this text does not fit");
+    printf("  \"%s\" (len=%zu, overflow=%s)\n", line, out.len, out.overflow ? "true" : "false");
+
+    // =====================================================================
+    // 5. hash.h 示例 / hash.h Examples
+    // =====================================================================
+    print_section("5. hash.h - 哈希函数 / Hash Functions");
+
+    // 64位哈希：相近的键得到完全不同的值 / 64-bit hash: similar keys give unrelated values
+    printf("\n[64位哈希 / 64-bit Hash]\n");
+    const char *keys[] = {"Alice", "Alicf", "Bob"};
+    for (size_t i = 0; i < UTILS_ARRAY_LEN(keys); i++) {
+        printf("  hash64_str(\"%s\") = 0x%016llx\n", keys[i],
+               (unsigned long long)hash64_str(keys[i]));
+    }
+
+    // CRC32C：标准校验值"123456789" -> 0xE3069283 / Standard check value
+    printf("\n[CRC32C]\n");
+    printf("  硬件加速 / Hardware accelerated: %s\n",
+           hash_crc32c_hw_available() ? "true" : "false");
+    const char *check = "123456789";
+    printf("  hash_crc32c(\"%s\")    = 0x%08X\n", check,
+           (unsigned)hash_crc32c(0, check, strlen(check)));
+    printf("  hash_crc32c_sw(\"%s\") = 0x%08X\n", check,
+           (unsigned)hash_crc32c_sw(0, check, strlen(check)));
+
+    // 分块计算与一次计算结果相同 / Chunked computation matches a single pass
+    uint32_t crc = hash_crc32c(0, check, 4);
+    crc = hash_crc32c(crc, check + 4, strlen(check) - 4);
+    printf("  分块 / Chunked (4 + 5)     = 0x%08X\n", (unsigned)crc);
+
+    // =====================================================================
+    // 6. codec.h 示例 / codec.h Examples
+    // =====================================================================
+    print_section("6. codec.h - 十六进制与Base64 / Hex and Base64");
+
+    const char *message = "Hello, World!";
+    size_t message_len = strlen(message);
+    char encoded[BASE64_ENCODED_SIZE(64)];
+    unsigned char decoded[64];
+    size_t decoded_len;
+
+    // 十六进制往返 / Hex round trip
+    printf("\n[十六进制 / Hex]\n");
+    hex_encode(encoded, message, message_len, true);
+    printf("  hex_encode(\"%s\") = %s\n", message, encoded);
+    if (hex_decode(decoded, encoded, strlen(encoded), &decoded_len)) {
+        printf("  hex_decode() = \"%.*s\"\n", (int)decoded_len, (const char *)decoded);
+    }
+    printf("  hex_decode(\"4G\") 有效 / valid: %s\n",
+           hex_decode(decoded, "4G", 2, &decoded_len) ? "true" : "false");
+
+    // Base64往返 / Base64 round trip
+    printf("\n[Base64]\n");
+    base64_encode(encoded, message, message_len);
+    printf("  base64_encode(\"%s\") = %s\n", message, encoded);
+    if (base64_decode(decoded, encoded, strlen(encoded), &decoded_len)) {
+        printf("  base64_decode() = \"%.*s\"\n", (int)decoded_len, (const char *)decoded);
+    }
+    printf("  base64_decode(\"SGV*bG8=\") 有效 / valid: %s\n",
+           base64_decode(decoded, "SGV*bG8=", 8, &decoded_len) ? "true" : "false");
+
+    // 整行写出的十六进制转储 / Hex dump written a whole line at a time
+    printf("\n[十六进制转储 / Hex Dump]\n");
+    hex_dump(stdout, numbers, sizeof(numbers));
+
+    // =====================================================================
+    // 7. str_distance.h 示例 / str_distance.h Examples
+    // =====================================================================
+    print_section("7. str_distance.h - 编辑距离 / Edit Distance");
+
+    // 单对比较 / A single pair
+    printf("\n[编辑距离 / Edit Distance]\n");
+    printf("  str_edit_distance(\"kitten\", \"sitting\") = %zu\n",
+           str_edit_distance("kitten", 6, "sitting", 7));
+    printf("  str_edit_distance_bounded(\"kitten\", \"sitting\", 2) = %zu (> 2)\n",
+           str_edit_distance_bounded("kitten", 6, "sitting", 7, 2));
+
+    // 模糊匹配人名去重 / Fuzzy matching to deduplicate person names
+    printf("\n[模糊匹配 / Fuzzy Matching]\n");
+    const char *query_name = "Zhang San";
+    const char *people[] = {
+        "Zhang San", "Zhang Shan", "Zhng San", "Li Si", "Wang Wu", "zhang san"
+    };
+    size_t people_count = sizeof(people) / sizeof(people[0]);
+    size_t distances[sizeof(people) / sizeof(people[0])];
+    str_edit_distance_batch(query_name, strlen(query_name), people, NULL, people_count, distances);
+    for (size_t i = 0; i < people_count; i++) {
+        printf("  \"%s\" vs \"%s\": %zu%s\n", query_name, people[i], distances[i],
+               distances[i] <= 1 ? "  <- 疑似重复 / likely duplicate" : "");
+    }
+
+    // =====================================================================
+    // 8. str_glob.h 示例 / str_glob.h Examples
+    // =====================================================================
+    print_section("8. str_glob.h - 通配符匹配 / Glob Matching");
+
+    // 编译一次，匹配多次 / Compile once, match many times
+    printf("\n[文件过滤 / File Filter]\n");
+    const char *files[] = { "main.c", "utils.h", "string_utils.c", "README.md", "str_glob.c" };
+    const char *filters[] = { "*.c", "*utils.[ch]", "str_????.?", "[!a-z]*" };
+    for (size_t f = 0; f < sizeof(filters) / sizeof(filters[0]); f++) {
+        glob_pattern_t *glob = glob_compile(filters[f]);
+        if (glob == NULL) {
+            continue;
+        }
+        printf("  %-12s ->", filters[f]);
+        for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+            if (glob_match(glob, files[i])) {
+                printf(" %s", files[i]);
+            }
+        }
+        printf("\n");
+        glob_free(glob);
+    }
+
+    // "前缀*" 和 "*后缀" 相当于 str_starts_with / str_ends_with
+    // "prefix*" and "*suffix" are str_starts_with / str_ends_with
+    printf("\n[前缀与后缀 / Prefix and Suffix]\n");
+    glob_pattern_t *prefix_glob = glob_compile("Hello*");
+    glob_pattern_t *suffix_glob = glob_compile("*World");
+    printf("  glob \"Hello*\" = %s, str_starts_with = %s\n",
+           glob_match(prefix_glob, "Hello World") ? "true" : "false",
+           str_starts_with("Hello World", "Hello") ? "true" : "false");
+    printf("  glob \"*World\" = %s, str_ends_with   = %s\n",
+           glob_match(suffix_glob, "Hello World") ? "true" : "false",
+           str_ends_with("Hello World", "World") ? "true" : "false");
+    glob_free(prefix_glob);
+    glob_free(suffix_glob);
+
+    // 末尾单独的'\'匹配字面反斜杠（fnmatch视为无效模式）
+    // A trailing lone '\' matches a literal backslash (fnmatch treats the pattern as invalid)
+    printf("\n[末尾反斜杠 / Trailing Backslash]\n");
+    glob_pattern_t *backslash_glob = glob_compile("dir\\");
+    if (backslash_glob != NULL) {
+        printf("  glob \"dir\\\" vs \"dir\\\" = %s, vs \"dir\" = %s\n",
+               glob_match(backslash_glob, "dir\\") ? "true" : "false",
+               glob_match(backslash_glob, "dir") ? "true" : "false");
+        glob_free(backslash_glob);
+    }
+
+    // =====================================================================
+    // 9. arena.h 示例 / arena.h Examples
+    // =====================================================================
+    print_section("9. arena.h - 内存区域 / Arena");
+
+    arena_t arena;
+    arena_init(&arena, 0);
+
+    // 超过STR_BUFFER_SIZE的字符串也不会截断 / Strings longer than STR_BUFFER_SIZE are not truncated
+    printf("\n[长字符串 / Long Strings]\n");
+    char long_text[STR_BUFFER_SIZE * 2];
+    for (size_t i = 0; i < sizeof(long_text) - 1; i++) {
+        long_text[i] = (char)('a' + i % 26);
+    }
+    long_text[sizeof(long_text) - 1] = '\0';
+    str_to_upper(long_text, buffer, sizeof(buffer));
+    char *long_upper = str_to_upper_a(&arena, str_view(long_text));
+    printf("  输入长度 / Input length: %zu\n", strlen(long_text));
+    printf("  str_to_upper()   -> %zu 字节 / bytes (截断 / truncated)\n", strlen(buffer));
+    printf("  str_to_upper_a() -> %zu 字节 / bytes\n", long_upper != NULL ? strlen(long_upper) : 0);
+
+    // 一个请求内的所有结果一次释放 / All of one request's results released at once
+    printf("\n[按请求释放 / Per-Request Release]\n");
+    const char *fields[] = { "  Alice  ", " Bob", "Charlie   " };
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+        char *trimmed = str_trim_a(&arena, str_view(fields[i]));
+        char *upper = str_to_upper_a(&arena, str_view(trimmed));
+        char *reversed = str_reverse_a(&arena, str_view(trimmed));
+        printf("  \"%s\" -> \"%s\", \"%s\", \"%s\"\n", fields[i], trimmed, upper, reversed);
+    }
+    printf("  已用 / Used: %zu 字节 / bytes, 保留 / Reserved: %zu 字节 / bytes\n",
+           arena.used, arena.reserved);
+    arena_reset(&arena);
+    printf("  arena_reset() 后已用 / Used after arena_reset(): %zu\n", arena.used);
+    arena_free(&arena);
+
+    // =====================================================================
+    // 10. str_intern.h 示例 / str_intern.h Examples
+    // =====================================================================
+    print_section("10. str_intern.h - 字符串驻留 / String Interning");
+
+    // 图书目录里同一作者反复出现 / The same author repeats throughout a book catalog
+    printf("\n[图书目录 / Book Catalog]\n");
+    const char *catalog[][2] = {
+        { "The C Programming Language", "Kernighan" },
+        { "The Practice of Programming", "Kernighan" },
+        { "The Unix Programming Environment", "Kernighan" },
+        { "Programming Pearls", "Bentley" },
+        { "More Programming Pearls", "Bentley" },
+    };
+    size_t num_books = sizeof(catalog) / sizeof(catalog[0]);
+    intern_pool_t pool;
+    intern_init(&pool);
+    const char *authors[sizeof(catalog) / sizeof(catalog[0])];
+    for (size_t i = 0; i < num_books; i++) {
+        intern_str(&pool, catalog[i][0]);
+        authors[i] = intern_str(&pool, catalog[i][1]);
+        printf("  %-34s %-10s %p\n", catalog[i][0], authors[i], (const void *)authors[i]);
+    }
+
+    // 相等比较变成指针比较 / Equality becomes pointer comparison
+    printf("\n[指针比较 / Pointer Comparison]\n");
+    printf("  authors[0] == authors[2]: %s\n", authors[0] == authors[2] ? "true" : "false");
+    printf("  authors[0] == authors[3]: %s\n", authors[0] == authors[3] ? "true" : "false");
+    printf("  intern_lookup(\"Bentley\") == authors[3]: %s\n",
+           intern_lookup(&pool, "Bentley", 7) == authors[3] ? "true" : "false");
+    printf("  intern_lookup(\"Ritchie\"): %s\n",
+           intern_lookup(&pool, "Ritchie", 7) != NULL ? "found" : "NULL");
+
+    // 批量驻留 / Bulk interning
+    const char *names[] = { "Kernighan", "Ritchie", "Bentley", "Ritchie" };
+    const char *canonical[sizeof(names) / sizeof(names[0])];
+    size_t interned = intern_bulk(&pool, names, NULL, sizeof(names) / sizeof(names[0]), canonical);
+    printf("  intern_bulk(): %zu 个 / interned, canonical[0] == authors[0]: %s\n",
+           interned, canonical[0] == authors[0] ? "true" : "false");
+
+    intern_stats_t intern_stats;
+    intern_get_stats(&pool, &intern_stats);
+    printf("\n[内存统计 / Memory Statistics]\n");
+    printf("  请求 / Requests: %zu, 不同字符串 / Unique: %zu\n",
+           intern_stats.requests, intern_stats.unique);
+    printf("  字符串字节 / String bytes: %zu -> %zu (节省 / saved %zu)\n",
+           intern_stats.bytes_requested, intern_stats.bytes_stored, intern_stats.bytes_saved);
+    intern_free(&pool);
+
+    // =====================================================================
+    // 11. str_builder.h 示例 / str_builder.h Examples
+    // =====================================================================
+    print_section("11. str_builder.h - 字符串构建器 / String Builder");
+
+    // 用追加代替strcat，不会重新扫描已有内容 / Append instead of strcat, never rescanning existing text
+    printf("\n[报表生成 / Report Generation]\n");
+    str_builder_t report;
+    sb_init(&report);
+    sb_append(&report, "  | book                             | author    |\n");
+    for (size_t i = 0; i < num_books; i++) {
+        sb_appendf(&report, "  | %-32s | %-9s |\n", catalog[i][0], catalog[i][1]);
+    }
+    sb_write_file(&report, stdout);   // 逐块输出，不合并 / Chunk by chunk, no flattening
+    printf("  长度 / Length: %zu, 块数 / Chunks: %zu\n", sb_length(&report), report.chunks);
+
+    // 需要连续字符串时再合并 / Flatten only when a contiguous string is needed
+    char *joined = sb_flatten(&report);
+    printf("  sb_flatten() -> strlen = %zu\n", joined != NULL ? strlen(joined) : 0);
+    free(joined);
+    sb_free(&report);
+
+    // =====================================================================
+    // 12. str_sort.h 示例 / str_sort.h Examples
+    // =====================================================================
+    print_section("12. str_sort.h - 字符串排序 / String Sorting");
+
+    const char *surnames[] = { "bentley", "Kernighan", "Ritchie", "knuth", "Pike", "Bentley", "aho" };
+    size_t num_surnames = sizeof(surnames) / sizeof(surnames[0]);
+
+    // 字节序：大写字母排在小写字母前面 / Byte order: uppercase sorts before lowercase
+    printf("\n[str_sort]\n ");
+    str_sort(surnames, num_surnames);
+    for (size_t i = 0; i < num_surnames; i++) {
+        printf(" %s", surnames[i]);
+    }
+
+    // 忽略大小写 / Ignoring case
+    printf("\n\n[str_sort_icase]\n ");
+    str_sort_icase(surnames, num_surnames);
+    for (size_t i = 0; i < num_surnames; i++) {
+        printf(" %s", surnames[i]);
+    }
+    printf("\n");
+
+    // =====================================================================
+    // 13. str_dict.h 示例 / str_dict.h Examples
+    // =====================================================================
+    print_section("13. str_dict.h - 前缀压缩字典 / Front-Coded Dictionary");
+
+    const char *titles[sizeof(catalog) / sizeof(catalog[0])];
+    for (size_t i = 0; i < num_books; i++) {
+        titles[i] = catalog[i][0];
+    }
+    str_sort(titles, num_books);
+    str_dict_t dict;
+    if (str_dict_build(&dict, titles, num_books)) {
+        printf("\n[有序书名 / Sorted Titles]\n");
+        for (size_t id = 0; id < dict.count; id++) {
+            str_dict_extract(&dict, id, buffer, sizeof(buffer));
+            printf("  %zu: %s\n", id, buffer);
+        }
+
+        printf("\n[查找 / Lookup]\n");
+        const char *wanted = "Programming Pearls";
+        printf("  str_dict_lookup(\"%s\") = %zu\n", wanted,
+               str_dict_lookup(&dict, wanted, strlen(wanted)));
+        size_t first, end;
+        if (str_dict_prefix_range(&dict, "The ", 4, &first, &end)) {
+            printf("  以 \"The \" 开头 / Starting with \"The \": [%zu, %zu)\n", first, end);
+        }
+        printf("  内存 / Memory: %zu 字节 / bytes (数据 / data %zu)\n",
+               str_dict_memory(&dict), dict.data_size);
+        str_dict_free(&dict);
+    }
+
+    // =====================================================================
+    // 14. word_freq.h 示例 / word_freq.h Examples
+    // =====================================================================
+    print_section("14. word_freq.h - 词频统计 / Word Frequency");
+
+    const char *passage = "the quick brown fox jumps over the lazy dog\n"
+                          "the dog sleeps and the fox runs\n";
+    word_freq_t freq;
+    if (word_freq_count(passage, strlen(passage), 0, &freq)) {
+        printf("\n  单词总数 / Total words: %llu, 不同单词 / Distinct: %zu\n",
+               (unsigned long long)freq.total_words, freq.count);
+        word_count_t top[3];
+        size_t num_top = word_freq_top(&freq, 3, top);
+        printf("  出现最多的 / Most frequent:\n");
+        for (size_t i = 0; i < num_top; i++) {
+            printf("    %-6.*s %llu\n", (int)top[i].len, top[i].word, (unsigned long long)top[i].count);
+        }
+        word_freq_free(&freq);
+    }
+
+    // =====================================================================
+    // 15. inv_index.h 示例 / inv_index.h Examples
+    // =====================================================================
+    print_section("15. inv_index.h - 倒排索引 / Inverted Index");
+
+    const char *shelf = "The C Programming Language\n"
+                        "The Art of Computer Programming\n"
+                        "Programming Pearls\n"
+                        "The Practice of Programming\n"
+                        "Expert C Programming\n";
+    inv_index_t index;
+    if (inv_index_build(&index, shelf, strlen(shelf))) {
+        printf("\n  %u 行 / lines, %zu 个词 / terms\n", index.num_docs, index.num_terms);
+        printf("  \"programming\" 出现在 / appears in %u 行 / lines\n",
+               inv_index_doc_freq(&index, "programming", 11));
+        const char *query[] = { "the", "PROGRAMMING" };
+        uint32_t lines[8];
+        size_t num_lines = inv_index_and(&index, query, 2, lines, 8);
+        printf("  the AND PROGRAMMING ->");
+        for (size_t i = 0; i < num_lines && i < 8; i++) {
+            printf(" %u", lines[i]);
+        }
+        printf("  (行号从0开始 / line numbers start at 0)\n");
+        inv_index_free(&index);
+    }
+
+    // =====================================================================
+    // 16. cdc.h 示例 / cdc.h Examples
+    // =====================================================================
+    print_section("16. cdc.h - 内容定义分块 / Content-Defined Chunking");
+
+    // 小块参数便于演示 / Small chunk sizes for the demo
+    cdc_chunker_t chunker;
+    cdc_store_t store;
+    size_t original_len = 16 * 1024;
+    unsigned char *original = malloc(original_len + 1);
+    unsigned char *edited = malloc(original_len + 1);
+    if (original != NULL && edited != NULL && cdc_init(&chunker, 64, 256, 1024) &&
+        cdc_store_open(&store, NULL)) {
+        uint64_t state = 1;
+        for (size_t i = 0; i < original_len; i++) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            original[i] = (unsigned char)(state >> 56);
+        }
+        // 在中间插入一个字节 / Insert one byte in the middle
+        memcpy(edited, original, original_len / 2);
+        edited[original_len / 2] = 'x';
+        memcpy(edited + original_len / 2 + 1, original + original_len / 2, original_len / 2);
+
+        cdc_store_add_buffer(&store, &chunker, original, original_len);
+        cdc_stats_t before = store.stats;
+        cdc_store_add_buffer(&store, &chunker, edited, original_len + 1);
+        printf("\n  原始数据 / Original: %zu 字节 / bytes, %llu 个块 / chunks\n", original_len,
+               (unsigned long long)before.chunks);
+        printf("  中间插入1字节后只有 %llu / %llu 个块是新的\n",
+               (unsigned long long)(store.stats.unique_chunks - before.unique_chunks),
+               (unsigned long long)(store.stats.chunks - before.chunks));
+        printf("  After inserting 1 byte in the middle only %llu / %llu chunks are new\n",
+               (unsigned long long)(store.stats.unique_chunks - before.unique_chunks),
+               (unsigned long long)(store.stats.chunks - before.chunks));
+        cdc_store_close(&store);
+    }
+    free(original);
+    free(edited);
+
+    // =====================================================================
+    // 17. tdigest.h 示例 / tdigest.h Examples
+    // =====================================================================
+    print_section("17. tdigest.h - 分位数草图 / Quantile Sketch");
+
+    // 10万个模拟延迟：大多在5到15ms之间，2%是100到500ms的慢请求
+    // 100,000 simulated latencies: mostly 5 to 15 ms, with 2% slow requests of 100 to 500 ms
+    tdigest_t latencies;
+    if (tdigest_init(&latencies, TDIGEST_DEFAULT_COMPRESSION)) {
+        double batch[1000];
+        uint64_t state = 7;
+        for (int b = 0; b < 100; b++) {
+            for (int i = 0; i < 1000; i++) {
+                state = state * 6364136223846793005ull + 1442695040888963407ull;
+                double u = (double)(state >> 11) / 9007199254740992.0;
+                batch[i] = i % 50 == 0 ? 100.0 + 400.0 * u : 5.0 + 10.0 * u;
+            }
+            tdigest_add_array(&latencies, batch, 1000);
+        }
+        printf("\n  %zu 个质心代表 %.0f 个值 / centroids stand for %.0f values\n",
+               latencies.num_centroids, latencies.total_weight, latencies.total_weight);
+        printf("  p50 = %.2f ms, p99 = %.2f ms, p999 = %.2f ms\n", tdigest_quantile(&latencies, 0.5),
+               tdigest_quantile(&latencies, 0.99), tdigest_quantile(&latencies, 0.999));
+        printf("  tdigest_cdf(50 ms) = %.4f (50ms以内的比例 / fraction within 50 ms)\n",
+               tdigest_cdf(&latencies, 50.0));
+        tdigest_free(&latencies);
+    }
+
+    // =====================================================================
+    // 18. window.h 示例 / window.h Examples
+    // =====================================================================
+    print_section("18. window.h - 滑动窗口聚合 / Sliding-Window Aggregates");
+
+    // 每秒一个CPU温度读数：最近5个读数，以及按时间戳的最近3秒
+    // One CPU temperature reading per second: the last 5 readings, and the last 3 seconds by timestamp
+    int temperatures[] = {61, 63, 70, 68, 66, 59, 57, 64};
+    long long seconds[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    size_t reading_count = UTILS_ARRAY_LEN(temperatures);
+    window_t last5, last3s;
+    bool windows_ok = window_init(&last5, 5);
+    windows_ok = window_init_timed(&last3s, 3) && windows_ok;
+    if (windows_ok) {
+        printf("\n  %-8s | %-24s | %-24s\n", "reading", "last 5: min/max/mean", "last 3 s: min/max/mean");
+        for (size_t i = 0; i < reading_count; i++) {
+            window_add(&last5, temperatures[i]);
+            window_add_at(&last3s, seconds[i], temperatures[i]);
+            int min5, max5, min3, max3;
+            window_min(&last5, &min5);
+            window_max(&last5, &max5);
+            window_min(&last3s, &min3);
+            window_max(&last3s, &max3);
+            printf("  %-8d | %4d %4d %8.2f       | %4d %4d %8.2f\n", temperatures[i], min5, max5,
+                   window_mean(&last5), min3, max3, window_mean(&last3s));
+        }
+        // 没有新读数时时间也在流逝 / Time passes even without new readings
+        window_advance(&last3s, 10);
+        printf("  window_advance(10): last 3 s 还剩 / still holds %zu 个读数 / readings\n", window_count(&last3s));
+    }
+    window_free(&last5);
+    window_free(&last3s);
+
+    // =====================================================================
+    // 19. 总结 / Summary
     // =====================================================================
-    print_section("3. 自定义头文件最佳实践 / Custom Header Best Practices");
+    print_section("19. 自定义头文件最佳实践 / Custom Header Best Practices");
     
     printf("\n[头文件结构 / Header Structure]\n");
     printf("  1. 头文件保护 (#ifndef/#define/#endif)\n");
@@ -0,0 +1,338 @@
+/**
+ * 字符串构建器实现文件 / String Builder Implementation
+ *
+ * 块按追加顺序连接成单链表。块一旦写入就不再移动，所以追加从不复制已有内容，
+ * 输出时各块直接作为writev的iovec。
+ *
+ * Chunks form a singly linked list in append order. A chunk never moves once written, so an
+ * append never copies existing content, and on output each chunk becomes one writev iovec.
+ */
+
+// writev需要POSIX声明 / writev needs the POSIX declarations
+#define _POSIX_C_SOURCE 200809L
+
+#include "str_builder.h"
+#include <stdint.h>   // 用于 SIZE_MAX / For SIZE_MAX
+#include <stdlib.h>   // 用于 malloc, free / For malloc, free
+#include <string.h>   // 用于 memcpy, strlen / For memcpy, strlen
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <io.h>        // 用于 _write / For _write
+#else
+    #include <errno.h>     // 用于 errno, EINTR / For errno, EINTR
+    #include <sys/uio.h>   // 用于 writev / For writev
+#endif
+
+// 每次writev提交的块数（远小于任何系统的IOV_MAX）
+// Chunks submitted per writev (well below any system's IOV_MAX)
+#define SB_IOV_BATCH 64
+
+// 块头，数据紧跟其后 / Chunk header; data follows it
+struct sb_chunk {
+    sb_chunk_t *next;
+    size_t size;            // 已写入字节数 / Bytes written
+    size_t capacity;        // 容量 / Capacity
+    char data[];
+};
+
+// 在末尾添加一个至少能放下min_size字节的新块
+// Add a new chunk at the end with room for at least min_size bytes
+static sb_chunk_t* sb_add_chunk(str_builder_t *sb, size_t min_size) {
+    size_t capacity = sb->next_size;
+    if (capacity < min_size) {
+        capacity = min_size;
+    }
+    if (capacity > SIZE_MAX - sizeof(sb_chunk_t)) {
+        return NULL;
+    }
+    sb_chunk_t *chunk = malloc(sizeof(sb_chunk_t) + capacity);
+    if (chunk == NULL) {
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->size = 0;
+    chunk->capacity = capacity;
+
+    if (sb->tail != NULL) {
+        sb->tail->next = chunk;
+    } else {
+        sb->head = chunk;
+    }
+    sb->tail = chunk;
+    sb->chunks++;
+    if (sb->next_size < SB_MAX_CHUNK_SIZE) {
+        sb->next_size *= 2;
+    }
+    return chunk;
+}
+
+// 初始化构建器 / Initialize a builder
+void sb_init(str_builder_t *sb) {
+    if (sb == NULL) {
+        return;
+    }
+    sb->head = NULL;
+    sb->tail = NULL;
+    sb->length = 0;
+    sb->chunks = 0;
+    sb->next_size = SB_MIN_CHUNK_SIZE;
+}
+
+// 追加字节 / Append bytes
+bool sb_append_n(str_builder_t *sb, const char *data, size_t len) {
+    if (sb == NULL || (data == NULL && len > 0)) {
+        return false;
+    }
+    sb_chunk_t *chunk = sb->tail;
+    size_t space = chunk != NULL ? chunk->capacity - chunk->size : 0;
+
+    // 常见情况：当前块放得下 / Common case: the current chunk has room
+    if (len <= space) {
+        if (len > 0) {
+            memcpy(chunk->data + chunk->size, data, len);
+            chunk->size += len;
+            sb->length += len;
+        }
+        return true;
+    }
+
+    // 填满当前块，剩余部分整段放进一个新块；先分配新块，失败时构建器保持不变
+    // Fill the current chunk, the rest goes into one new chunk; the new chunk is allocated first so a
+    // failure leaves the builder unchanged
+    sb_chunk_t *next = sb_add_chunk(sb, len - space);
+    if (next == NULL) {
+        return false;
+    }
+    if (space > 0) {
+        memcpy(chunk->data + chunk->size, data, space);
+        chunk->size += space;
+        data += space;
+        len -= space;
+    }
+    memcpy(next->data, data, len);
+    next->size = len;
+    sb->length += space + len;
+    return true;
+}
+
+// 追加以'\0'结尾的字符串 / Append a '\0'-terminated string
+bool sb_append(str_builder_t *sb, const char *str) {
+    if (str == NULL) {
+        return false;
+    }
+    return sb_append_n(sb, str, strlen(str));
+}
+
+// 追加一个字符 / Append one character
+bool sb_append_char(str_builder_t *sb, char c) {
+    if (sb != NULL && sb->tail != NULL && sb->tail->size < sb->tail->capacity) {
+        sb->tail->data[sb->tail->size++] = c;
+        sb->length++;
+        return true;
+    }
+    return sb_append_n(sb, &c, 1);
+}
+
+// 格式化追加（va_list版本）/ Formatted append (va_list version)
+bool sb_vappendf(str_builder_t *sb, const char *format, va_list args) {
+    if (sb == NULL || format == NULL) {
+        return false;
+    }
+
+    // 先尝试直接写入当前块剩余空间（vsnprintf需要一个字节放'\0'）
+    // First try the current chunk's free space directly (vsnprintf needs one byte for '\0')
+    sb_chunk_t *chunk = sb->tail;
+    size_t space = chunk != NULL ? chunk->capacity - chunk->size : 0;
+    va_list copy;
+    va_copy(copy, args);
+    int n = vsnprintf(space > 0 ? chunk->data + chunk->size : NULL, space, format, copy);
+    va_end(copy);
+    if (n < 0) {
+        return false;
+    }
+    if ((size_t)n < space) {
+        chunk->size += (size_t)n;
+        sb->length += (size_t)n;
+        return true;
+    }
+
+    // 放不下：在新块中重新格式化，当前块剩余空间留空
+    // Does not fit: format again into a new chunk, leaving the current chunk's tail unused
+    chunk = sb_add_chunk(sb, (size_t)n + 1);
+    if (chunk == NULL) {
+        return false;
+    }
+    va_copy(copy, args);
+    vsnprintf(chunk->data, chunk->capacity, format, copy);
+    va_end(copy);
+    chunk->size = (size_t)n;
+    sb->length += (size_t)n;
+    return true;
+}
+
+// 格式化追加 / Formatted append
+bool sb_appendf(str_builder_t *sb, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    bool ok = sb_vappendf(sb, format, args);
+    va_end(args);
+    return ok;
+}
+
+// 获取总长度 / Get the total length
+size_t sb_length(const str_builder_t *sb) {
+    return sb != NULL ? sb->length : 0;
+}
+
+// 复制到缓冲区 / Copy into a buffer
+size_t sb_copy_to(const str_builder_t *sb, char *buffer, size_t size) {
+    if (sb == NULL) {
+        return 0;
+    }
+    if (buffer == NULL || size == 0) {
+        return sb->length;
+    }
+    size_t pos = 0;
+    for (const sb_chunk_t *c = sb->head; c != NULL && pos < size - 1; c = c->next) {
+        size_t n = c->size < size - 1 - pos ? c->size : size - 1 - pos;
+        memcpy(buffer + pos, c->data, n);
+        pos += n;
+    }
+    buffer[pos] = '\0';
+    return sb->length;
+}
+
+// 合并为一个新字符串 / Flatten into a new string
+char* sb_flatten(const str_builder_t *sb) {
+    if (sb == NULL || sb->length == SIZE_MAX) {
+        return NULL;
+    }
+    char *result = malloc(sb->length + 1);
+    if (result != NULL) {
+        sb_copy_to(sb, result, sb->length + 1);
+    }
+    return result;
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+// 写入文件描述符（Windows没有writev，逐块写）/ Write to a descriptor (no writev on Windows, chunk by chunk)
+bool sb_write_fd(const str_builder_t *sb, int fd) {
+    if (sb == NULL) {
+        return false;
+    }
+    for (const sb_chunk_t *c = sb->head; c != NULL; c = c->next) {
+        size_t done = 0;
+        while (done < c->size) {
+            size_t left = c->size - done;
+            unsigned int n = left > 0x40000000u ? 0x40000000u : (unsigned int)left;
+            int w = _write(fd, c->data + done, n);
+            if (w <= 0) {
+                return false;
+            }
+            done += (size_t)w;
+        }
+    }
+    return true;
+}
+
+#else
+
+// 写入文件描述符，不合并 / Write to a file descriptor without flattening
+bool sb_write_fd(const str_builder_t *sb, int fd) {
+    if (sb == NULL) {
+        return false;
+    }
+    struct iovec iov[SB_IOV_BATCH];
+    const sb_chunk_t *chunk = sb->head;
+    size_t offset = 0;   // chunk中已写出的字节数 / Bytes of chunk already written
+
+    for (;;) {
+        // 收集下一批非空块 / Gather the next batch of non-empty chunks
+        int count = 0;
+        size_t skip = offset;
+        for (const sb_chunk_t *c = chunk; c != NULL && count < SB_IOV_BATCH; c = c->next) {
+            if (c->size > skip) {
+                iov[count].iov_base = (void *)(c->data + skip);
+                iov[count].iov_len = c->size - skip;
+                count++;
+            }
+            skip = 0;
+        }
+        if (count == 0) {
+            return true;
+        }
+
+        ssize_t written = writev(fd, iov, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (written == 0) {
+            return false;
+        }
+
+        // 按实际写出的字节数前进，处理部分写入 / Advance by what was written, resuming partial writes
+        size_t left = (size_t)written;
+        while (chunk != NULL && left > 0) {
+            size_t rest = chunk->size - offset;
+            if (left >= rest) {
+                left -= rest;
+                chunk = chunk->next;
+                offset = 0;
+            } else {
+                offset += left;
+                left = 0;
+            }
+        }
+    }
+}
+
+#endif
+
+// 写入FILE流，不合并 / Write to a FILE stream without flattening
+bool sb_write_file(const str_builder_t *sb, FILE *stream) {
+    if (sb == NULL || stream == NULL) {
+        return false;
+    }
+    for (const sb_chunk_t *c = sb->head; c != NULL; c = c->next) {
+        if (fwrite(c->data, 1, c->size, stream) != c->size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 清空内容，保留第一个块 / Clear the contents, keeping the first chunk
+void sb_reset(str_builder_t *sb) {
+    if (sb == NULL || sb->head == NULL) {
+        return;
+    }
+    sb_chunk_t *chunk = sb->head->next;
+    while (chunk != NULL) {
+        sb_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    sb->head->next = NULL;
+    sb->head->size = 0;
+    sb->tail = sb->head;
+    sb->length = 0;
+    sb->chunks = 1;
+}
+
+// 释放所有块 / Free every chunk
+void sb_free(str_builder_t *sb) {
+    if (sb == NULL) {
+        return;
+    }
+    sb_chunk_t *chunk = sb->head;
+    while (chunk != NULL) {
+        sb_chunk_t *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    sb_init(sb);
+}
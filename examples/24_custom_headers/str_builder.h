@@ -0,0 +1,164 @@
+/**
+ * 字符串构建器头文件 / String Builder Header
+ *
+ * 用块链表拼接字符串：追加均摊O(1)，不会像strcat那样每次重新扫描目标串，
+ * 输出时可以用writev直接把各块写到文件描述符，不必先合并
+ * Builds strings from a list of chunks: appends are amortized O(1) instead of rescanning the
+ * destination like strcat, and output can go straight to a file descriptor with writev,
+ * without flattening first
+ */
+
+#ifndef STR_BUILDER_H
+#define STR_BUILDER_H
+
+#include <stdarg.h>   // 用于 va_list / For va_list
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdio.h>    // 用于 FILE / For FILE
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 第一个块的容量 / Capacity of the first chunk
+#define SB_MIN_CHUNK_SIZE 256
+
+// 块容量翻倍的上限 / Cap on chunk capacity doubling
+#define SB_MAX_CHUNK_SIZE (64 * 1024)
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+typedef struct sb_chunk sb_chunk_t;
+
+// 字符串构建器 / String builder
+typedef struct {
+    sb_chunk_t *head;       // 第一个块 / First chunk
+    sb_chunk_t *tail;       // 正在写入的块 / Chunk being written
+    size_t length;          // 总长度 / Total length
+    size_t chunks;          // 块数 / Number of chunks
+    size_t next_size;       // 下一个块的容量 / Capacity of the next chunk
+} str_builder_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 初始化构建器（不分配内存）/ Initialize a builder (allocates nothing)
+ * @param sb 构建器 / Builder
+ */
+void sb_init(str_builder_t *sb);
+
+/**
+ * 追加字节 / Append bytes
+ *
+ * 先填满当前块，剩下的放进新块；块容量从SB_MIN_CHUNK_SIZE翻倍到SB_MAX_CHUNK_SIZE，
+ * 已写入的内容从不移动
+ * Fills the current chunk first and puts the rest in a new one; chunk capacity doubles from
+ * SB_MIN_CHUNK_SIZE up to SB_MAX_CHUNK_SIZE, and written bytes never move
+ *
+ * @param sb 构建器 / Builder
+ * @param data 数据（可以包含'\0'）/ Data (may contain '\0')
+ * @param len 长度 / Length
+ * @return 成功返回true，内存不足返回false，构建器保持不变 / true on success, false when out of memory,
+ *         leaving the builder unchanged
+ */
+bool sb_append_n(str_builder_t *sb, const char *data, size_t len);
+
+/**
+ * 追加以'\0'结尾的字符串 / Append a '\0'-terminated string
+ * @param sb 构建器 / Builder
+ * @param str 字符串 / String
+ * @return 成功返回true / true on success
+ */
+bool sb_append(str_builder_t *sb, const char *str);
+
+/**
+ * 追加一个字符 / Append one character
+ * @param sb 构建器 / Builder
+ * @param c 字符 / Character
+ * @return 成功返回true / true on success
+ */
+bool sb_append_char(str_builder_t *sb, char c);
+
+/**
+ * 格式化追加（直接写入当前块，放不下时才另开一块）
+ * Formatted append (written straight into the current chunk; a new chunk only when it does not fit)
+ * @param sb 构建器 / Builder
+ * @param format 格式字符串 / Format string
+ * @return 成功返回true / true on success
+ */
+bool sb_appendf(str_builder_t *sb, const char *format, ...)
+#if defined(__GNUC__)
+    __attribute__((format(printf, 2, 3)))
+#endif
+    ;
+
+/**
+ * 格式化追加（va_list版本）/ Formatted append (va_list version)
+ * @param sb 构建器 / Builder
+ * @param format 格式字符串 / Format string
+ * @param args 参数 / Arguments
+ * @return 成功返回true / true on success
+ */
+bool sb_vappendf(str_builder_t *sb, const char *format, va_list args);
+
+/**
+ * 获取总长度 / Get the total length
+ * @param sb 构建器 / Builder
+ * @return 字节数 / Number of bytes
+ */
+size_t sb_length(const str_builder_t *sb);
+
+/**
+ * 复制到缓冲区 / Copy into a buffer
+ * @param sb 构建器 / Builder
+ * @param buffer 输出缓冲区 / Output buffer
+ * @param size 缓冲区大小（含'\0'）/ Buffer size (including '\0')
+ * @return 完整内容的长度，大于等于size表示被截断 / Full length; size or more means truncated
+ */
+size_t sb_copy_to(const str_builder_t *sb, char *buffer, size_t size);
+
+/**
+ * 合并为一个新字符串 / Flatten into a new string
+ * @param sb 构建器 / Builder
+ * @return 以'\0'结尾的副本（调用者free），失败返回NULL / '\0'-terminated copy (caller frees), or NULL
+ */
+char* sb_flatten(const str_builder_t *sb);
+
+/**
+ * 写入文件描述符，不合并 / Write to a file descriptor without flattening
+ *
+ * POSIX上每次writev最多提交64个块并处理部分写入；Windows上逐块write
+ * On POSIX each writev submits up to 64 chunks and partial writes are resumed;
+ * on Windows chunks are written one by one
+ *
+ * @param sb 构建器 / Builder
+ * @param fd 文件描述符 / File descriptor
+ * @return 全部写入返回true，出错返回false / true when everything was written, false on error
+ */
+bool sb_write_fd(const str_builder_t *sb, int fd);
+
+/**
+ * 写入FILE流，不合并 / Write to a FILE stream without flattening
+ * @param sb 构建器 / Builder
+ * @param stream 文件流 / Stream
+ * @return 全部写入返回true / true when everything was written
+ */
+bool sb_write_file(const str_builder_t *sb, FILE *stream);
+
+/**
+ * 清空内容，保留第一个块供复用 / Clear the contents, keeping the first chunk for reuse
+ * @param sb 构建器 / Builder
+ */
+void sb_reset(str_builder_t *sb);
+
+/**
+ * 释放所有块 / Free every chunk
+ * @param sb 构建器 / Builder
+ */
+void sb_free(str_builder_t *sb);
+
+#endif // STR_BUILDER_H
@@ -0,0 +1,340 @@
+/**
+ * 前缀压缩字符串字典实现文件 / Front-Coded String Dictionary Implementation
+ *
+ * 编码格式（长度都是LEB128变长整数）/ Encoding (all lengths are LEB128 varints):
+ *   桶首 / bucket head:  长度 / length, 字节 / bytes
+ *   其余 / others:       公共前缀长度 / shared prefix length, 后缀长度 / suffix length, 后缀 / suffix
+ *
+ * 有序的书名相邻时通常有很长的公共前缀（"The Art of ..."），所以后缀很短；
+ * 每个桶只需要一个偏移，对比每个字符串一个指针加一次malloc，内存小得多。
+ * Neighbouring sorted titles usually share long prefixes ("The Art of ..."), so suffixes are
+ * short; each bucket needs a single offset, far less than a pointer plus a malloc per string.
+ */
+
+#include "str_dict.h"
+#include <stdlib.h>   // 用于 malloc, free / For malloc, free
+#include <string.h>   // 用于 memcpy, strlen, strcmp / For memcpy, strlen, strcmp
+
+// =====================================================================
+// 变长整数 / Varints
+// =====================================================================
+
+static size_t varint_size(size_t value) {
+    size_t n = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        n++;
+    }
+    return n;
+}
+
+static unsigned char* varint_write(unsigned char *p, size_t value) {
+    while (value >= 0x80) {
+        *p++ = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    *p++ = (unsigned char)value;
+    return p;
+}
+
+static inline const unsigned char* varint_read(const unsigned char *p, size_t *value) {
+    // 绝大多数长度小于128，只有一个字节 / Almost every length is below 128, a single byte
+    if (*p < 0x80) {
+        *value = *p;
+        return p + 1;
+    }
+    size_t result = 0;
+    int shift = 0;
+    while (*p >= 0x80) {
+        result |= (size_t)(*p++ & 0x7F) << shift;
+        shift += 7;
+    }
+    *value = result | ((size_t)*p++ << shift);
+    return p;
+}
+
+// =====================================================================
+// 比较 / Comparison
+// =====================================================================
+
+// 前n个字节中公共前缀的长度 / Length of the common prefix within the first n bytes
+static inline size_t common_prefix(const unsigned char *a, const unsigned char *b, size_t n) {
+    size_t i = 0;
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // 每次比较8个字节，第一个不同字节由异或结果的最低位给出
+    // 8 bytes at a time; the first differing byte comes from the lowest set bit of the xor
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x, y;
+        memcpy(&x, a + i, 8);
+        memcpy(&y, b + i, 8);
+        if (x != y) {
+            return i + (size_t)(__builtin_ctzll(x ^ y) >> 3);
+        }
+    }
+#endif
+    while (i < n && a[i] == b[i]) {
+        i++;
+    }
+    return i;
+}
+
+// 桶首是否排在key之前 / Whether a bucket head sorts before key
+//
+// past_prefix为true时，以key开头的字符串也算在key之前，用于求前缀范围的末尾
+// With past_prefix, strings starting with key also count as before it, which finds the end of a prefix range
+static bool head_before(const unsigned char *head, size_t head_len,
+                        const unsigned char *key, size_t key_len, bool past_prefix,
+                        size_t *match, bool *equal) {
+    size_t c = common_prefix(head, key, head_len < key_len ? head_len : key_len);
+    *match = c;
+    *equal = false;
+    if (c == key_len) {
+        if (past_prefix) {
+            return true;
+        }
+        *equal = head_len == key_len;
+        return false;
+    }
+    if (c == head_len) {
+        return true;   // 桶首是key的真前缀 / The head is a proper prefix of key
+    }
+    return head[c] < key[c];
+}
+
+// 第b个桶首 / The b-th bucket head
+static inline const unsigned char* bucket_head(const str_dict_t *dict, size_t b, size_t *len) {
+    return varint_read(dict->data + dict->buckets[b], len);
+}
+
+// 第一个不排在key之前的ID / First ID not sorting before key
+static size_t dict_search(const str_dict_t *dict, const unsigned char *key, size_t key_len,
+                          bool past_prefix, bool *exact) {
+    *exact = false;
+    if (dict == NULL || dict->count == 0) {
+        return 0;
+    }
+
+    // 二分查找：排在key之前的桶首个数 / Binary search: number of bucket heads before key
+    size_t lo = 0, hi = dict->num_buckets;
+    size_t match;
+    bool equal;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        size_t head_len;
+        const unsigned char *head = bucket_head(dict, mid, &head_len);
+        if (head_before(head, head_len, key, key_len, past_prefix, &match, &equal)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo > 0) {
+        // 在前一个桶里顺序查找 / Scan the previous bucket
+        size_t b = lo - 1;
+        size_t head_len;
+        const unsigned char *p = bucket_head(dict, b, &head_len);
+        head_before(p, head_len, key, key_len, past_prefix, &match, &equal);
+        p += head_len;
+
+        // match是上一个字符串与key的公共前缀长度，上一个字符串总是排在key之前
+        // match is the common prefix of the previous string and key; the previous string always sorts before key
+        size_t first = b * STR_DICT_BUCKET_SIZE;
+        size_t last = first + STR_DICT_BUCKET_SIZE < dict->count ? first + STR_DICT_BUCKET_SIZE : dict->count;
+        for (size_t id = first + 1; id < last; id++) {
+            size_t shared, suffix_len;
+            p = varint_read(p, &shared);
+            p = varint_read(p, &suffix_len);
+            const unsigned char *suffix = p;
+            p += suffix_len;
+
+            if (shared > match || (shared == match && match == key_len)) {
+                // 与上一个字符串在第match个字节上相同，仍排在key之前
+                // Same as the previous string at byte match, so still before key
+                continue;
+            }
+            if (shared < match) {
+                return id;   // 第shared个字节大于key / Byte shared is greater than key's
+            }
+            size_t n = suffix_len < key_len - match ? suffix_len : key_len - match;
+            size_t c = common_prefix(suffix, key + match, n);
+            if (match + c == key_len) {
+                if (past_prefix) {
+                    match = key_len;
+                    continue;
+                }
+                *exact = c == suffix_len;
+                return id;
+            }
+            if (c == suffix_len || suffix[c] < key[match + c]) {
+                match += c;
+                continue;
+            }
+            return id;
+        }
+    }
+
+    // 答案是第lo个桶的桶首 / The answer is the head of bucket lo
+    if (lo < dict->num_buckets && !past_prefix) {
+        size_t head_len;
+        const unsigned char *head = bucket_head(dict, lo, &head_len);
+        head_before(head, head_len, key, key_len, false, &match, exact);
+    }
+    size_t id = lo * STR_DICT_BUCKET_SIZE;
+    return id < dict->count ? id : dict->count;
+}
+
+// =====================================================================
+// 函数实现 / Function Implementations
+// =====================================================================
+
+// 从已排序的字符串构建字典 / Build a dictionary from sorted strings
+bool str_dict_build(str_dict_t *dict, const char *const *sorted, size_t count) {
+    if (dict == NULL) {
+        return false;
+    }
+    memset(dict, 0, sizeof(*dict));
+    if (count == 0) {
+        return true;
+    }
+    if (sorted == NULL) {
+        return false;
+    }
+
+    // 第一遍：检查顺序并计算大小 / First pass: check the order and compute the size
+    size_t size = 0, max_length = 0, prev_len = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t len = strlen(sorted[i]);
+        if (i > 0 && strcmp(sorted[i - 1], sorted[i]) >= 0) {
+            return false;
+        }
+        if (i % STR_DICT_BUCKET_SIZE == 0) {
+            size += varint_size(len) + len;
+        } else {
+            size_t shared = common_prefix((const unsigned char *)sorted[i - 1],
+                                          (const unsigned char *)sorted[i],
+                                          prev_len < len ? prev_len : len);
+            size += varint_size(shared) + varint_size(len - shared) + len - shared;
+        }
+        if (len > max_length) {
+            max_length = len;
+        }
+        prev_len = len;
+    }
+
+    size_t num_buckets = (count + STR_DICT_BUCKET_SIZE - 1) / STR_DICT_BUCKET_SIZE;
+    dict->data = malloc(size);
+    dict->buckets = malloc(num_buckets * sizeof(size_t));
+    if (dict->data == NULL || dict->buckets == NULL) {
+        str_dict_free(dict);
+        return false;
+    }
+
+    // 第二遍：编码 / Second pass: encode
+    unsigned char *p = dict->data;
+    for (size_t i = 0; i < count; i++) {
+        const unsigned char *s = (const unsigned char *)sorted[i];
+        size_t len = strlen(sorted[i]);
+        if (i % STR_DICT_BUCKET_SIZE == 0) {
+            dict->buckets[i / STR_DICT_BUCKET_SIZE] = (size_t)(p - dict->data);
+            p = varint_write(p, len);
+            memcpy(p, s, len);
+            p += len;
+        } else {
+            size_t shared = common_prefix((const unsigned char *)sorted[i - 1], s,
+                                          prev_len < len ? prev_len : len);
+            p = varint_write(p, shared);
+            p = varint_write(p, len - shared);
+            memcpy(p, s + shared, len - shared);
+            p += len - shared;
+        }
+        prev_len = len;
+    }
+
+    dict->data_size = size;
+    dict->num_buckets = num_buckets;
+    dict->count = count;
+    dict->max_length = max_length;
+    return true;
+}
+
+// 查找字符串的ID / Look up a string's ID
+size_t str_dict_lookup(const str_dict_t *dict, const char *str, size_t len) {
+    if (str == NULL) {
+        return STR_DICT_NOT_FOUND;
+    }
+    bool exact;
+    size_t id = dict_search(dict, (const unsigned char *)str, len, false, &exact);
+    return exact ? id : STR_DICT_NOT_FOUND;
+}
+
+// 第一个不小于给定字符串的ID / First ID whose string is not less than the given one
+size_t str_dict_lower_bound(const str_dict_t *dict, const char *str, size_t len) {
+    if (str == NULL) {
+        return 0;
+    }
+    bool exact;
+    return dict_search(dict, (const unsigned char *)str, len, false, &exact);
+}
+
+// 取出字符串 / Extract a string
+size_t str_dict_extract(const str_dict_t *dict, size_t id, char *buffer, size_t size) {
+    if (dict == NULL || id >= dict->count || (buffer == NULL && size > 0)) {
+        return STR_DICT_NOT_FOUND;
+    }
+    // 只保留前size - 1个字节：后面的字符串从中复用前缀时，超出部分本来也不会写入缓冲区
+    // Keep only the first size - 1 bytes: shared-prefix bytes past them would never reach the buffer anyway
+    size_t keep = size > 0 ? size - 1 : 0;
+
+    size_t len;
+    const unsigned char *p = bucket_head(dict, id / STR_DICT_BUCKET_SIZE, &len);
+    memcpy(buffer, p, len < keep ? len : keep);
+    p += len;
+
+    for (size_t i = id % STR_DICT_BUCKET_SIZE; i > 0; i--) {
+        size_t shared, suffix_len;
+        p = varint_read(p, &shared);
+        p = varint_read(p, &suffix_len);
+        if (shared < keep) {
+            size_t n = suffix_len < keep - shared ? suffix_len : keep - shared;
+            memcpy(buffer + shared, p, n);
+        }
+        p += suffix_len;
+        len = shared + suffix_len;
+    }
+
+    if (size > 0) {
+        buffer[len < keep ? len : keep] = '\0';
+    }
+    return len;
+}
+
+// 前缀范围查询 / Prefix range query
+bool str_dict_prefix_range(const str_dict_t *dict, const char *prefix, size_t len,
+                           size_t *first, size_t *end) {
+    if (prefix == NULL || first == NULL || end == NULL) {
+        return false;
+    }
+    bool exact;
+    *first = dict_search(dict, (const unsigned char *)prefix, len, false, &exact);
+    *end = dict_search(dict, (const unsigned char *)prefix, len, true, &exact);
+    return *first < *end;
+}
+
+// 字典占用的内存 / Memory used by the dictionary
+size_t str_dict_memory(const str_dict_t *dict) {
+    if (dict == NULL) {
+        return 0;
+    }
+    return sizeof(*dict) + dict->data_size + dict->num_buckets * sizeof(size_t);
+}
+
+// 释放字典 / Free a dictionary
+void str_dict_free(str_dict_t *dict) {
+    if (dict == NULL) {
+        return;
+    }
+    free(dict->data);
+    free(dict->buckets);
+    memset(dict, 0, sizeof(*dict));
+}
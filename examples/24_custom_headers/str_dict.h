@@ -0,0 +1,124 @@
+/**
+ * 前缀压缩字符串字典头文件 / Front-Coded String Dictionary Header
+ *
+ * 只读的有序字符串字典：字符串按固定大小分桶，每桶第一个字符串完整保存，
+ * 其余只保存与前一个字符串的公共前缀长度和剩余后缀
+ * A read-only dictionary of sorted strings: strings are grouped into fixed-size buckets, the first
+ * string of each bucket is stored whole and the rest store only the length of the prefix shared
+ * with the previous string plus the remaining suffix
+ */
+
+#ifndef STR_DICT_H
+#define STR_DICT_H
+
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdint.h>   // 用于 SIZE_MAX / For SIZE_MAX
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 每个桶的字符串数 / Strings per bucket
+#define STR_DICT_BUCKET_SIZE 16
+
+// 未找到 / Not found
+#define STR_DICT_NOT_FOUND SIZE_MAX
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 前缀压缩字典 / Front-coded dictionary
+typedef struct {
+    unsigned char *data;    // 编码后的字符串 / Encoded strings
+    size_t data_size;       // data的字节数 / Bytes in data
+    size_t *buckets;        // 每个桶在data中的偏移 / Offset of each bucket in data
+    size_t num_buckets;     // 桶数 / Number of buckets
+    size_t count;           // 字符串数 / Number of strings
+    size_t max_length;      // 最长字符串的长度 / Length of the longest string
+} str_dict_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 从已排序的字符串构建字典 / Build a dictionary from sorted strings
+ *
+ * 字符串的ID就是它在输入中的下标 / A string's ID is its index in the input
+ *
+ * @param dict 字典 / Dictionary
+ * @param sorted 按strcmp严格递增（无重复）的字符串 / Strings strictly increasing by strcmp (no duplicates)
+ * @param count 个数 / Count
+ * @return 成功返回true；输入无序、有重复或内存不足返回false
+ *         true on success; false when the input is unsorted, has duplicates or memory runs out
+ */
+bool str_dict_build(str_dict_t *dict, const char *const *sorted, size_t count);
+
+/**
+ * 查找字符串的ID / Look up a string's ID
+ *
+ * 对桶首字符串二分查找，再在一个桶内顺序解码；解码时利用公共前缀长度跳过大部分字节比较
+ * Binary search over bucket heads, then a sequential decode of one bucket that uses the
+ * shared-prefix lengths to skip most byte comparisons
+ *
+ * @param dict 字典 / Dictionary
+ * @param str 字符串 / String
+ * @param len 长度 / Length
+ * @return ID，不存在返回STR_DICT_NOT_FOUND / ID, or STR_DICT_NOT_FOUND if absent
+ */
+size_t str_dict_lookup(const str_dict_t *dict, const char *str, size_t len);
+
+/**
+ * 第一个不小于给定字符串的ID / First ID whose string is not less than the given one
+ * @param dict 字典 / Dictionary
+ * @param str 字符串 / String
+ * @param len 长度 / Length
+ * @return ID，所有字符串都更小时返回count / ID, or count when every string is smaller
+ */
+size_t str_dict_lower_bound(const str_dict_t *dict, const char *str, size_t len);
+
+/**
+ * 取出字符串 / Extract a string
+ *
+ * 与snprintf相同：最多写入size - 1个字节并以'\0'结尾，返回完整长度
+ * Like snprintf: writes at most size - 1 bytes plus '\0' and returns the full length
+ *
+ * @param dict 字典 / Dictionary
+ * @param id 字符串ID / String ID
+ * @param buffer 输出缓冲区（max_length + 1字节一定够用）/ Output buffer (max_length + 1 bytes always suffice)
+ * @param size 缓冲区大小 / Buffer size
+ * @return 字符串长度，ID无效返回STR_DICT_NOT_FOUND / String length, or STR_DICT_NOT_FOUND for an invalid ID
+ */
+size_t str_dict_extract(const str_dict_t *dict, size_t id, char *buffer, size_t size);
+
+/**
+ * 前缀范围查询 / Prefix range query
+ *
+ * 以prefix开头的字符串的ID正好是[*first, *end) / IDs of the strings starting with prefix are exactly [*first, *end)
+ *
+ * @param dict 字典 / Dictionary
+ * @param prefix 前缀 / Prefix
+ * @param len 前缀长度 / Prefix length
+ * @param first 输出：第一个ID / Output: first ID
+ * @param end 输出：最后一个ID之后 / Output: one past the last ID
+ * @return 范围非空返回true / true when the range is non-empty
+ */
+bool str_dict_prefix_range(const str_dict_t *dict, const char *prefix, size_t len,
+                           size_t *first, size_t *end);
+
+/**
+ * 字典占用的内存 / Memory used by the dictionary
+ * @param dict 字典 / Dictionary
+ * @return 字节数 / Number of bytes
+ */
+size_t str_dict_memory(const str_dict_t *dict);
+
+/**
+ * 释放字典 / Free a dictionary
+ * @param dict 字典 / Dictionary
+ */
+void str_dict_free(str_dict_t *dict);
+
+#endif // STR_DICT_H
@@ -0,0 +1,305 @@
+/**
+ * 字符串编辑距离实现文件 / String Edit Distance Implementation
+ *
+ * 经典动态规划逐格计算 O(n·m) 个单元格。Myers算法（1999，Hyyrö的表述）把一整列的
+ * 纵向差值（只可能是-1/0/+1）编码为两个位向量Pv/Mv，用几次位运算和一次加法就能
+ * 推进一整列，复杂度降为 O(n·⌈m/64⌉)。
+ *
+ * Classic dynamic programming fills O(n·m) cells one by one. Myers' algorithm (1999, in
+ * Hyyrö's formulation) encodes a whole column's vertical deltas (only -1/0/+1) as two bit
+ * vectors Pv/Mv, advancing an entire column with a few bit operations and one addition:
+ * O(n·⌈m/64⌉).
+ */
+
+#include "str_distance.h"
+#include <stdint.h>   // 用于 uint64_t / For uint64_t
+#include <stdlib.h>   // 用于 malloc, free / For malloc, free
+#include <string.h>   // 用于 memset, strlen / For memset, strlen
+
+#if defined(__SSE2__)
+#include <emmintrin.h>  // SSE2
+#endif
+
+// =====================================================================
+// 单字版本（模式串 <= 64字节）/ Single-Word Version (pattern <= 64 bytes)
+// =====================================================================
+
+// 构造匹配位表：peq[c]的第i位表示p[i] == c / Build the match table: bit i of peq[c] means p[i] == c
+// 短字符串只清零会被访问到的表项，避免每次清零整张2KB的表
+// Short strings clear only the entries that will be read, instead of the whole 2 KB table
+static void build_peq64(uint64_t peq[256], const unsigned char *p, size_t m,
+                        const unsigned char *t, size_t n) {
+    if (m + n < 256) {
+        for (size_t j = 0; j < n; j++) {
+            peq[t[j]] = 0;
+        }
+        for (size_t i = 0; i < m; i++) {
+            peq[p[i]] = 0;
+        }
+    } else {
+        memset(peq, 0, 256 * sizeof(uint64_t));
+    }
+    for (size_t i = 0; i < m; i++) {
+        peq[p[i]] |= (uint64_t)1 << i;
+    }
+}
+
+// 剩余remaining列最多让距离减少remaining，若仍超过上限则可以提前结束
+// The remaining columns can lower the score by at most `remaining`; if it still exceeds the bound, stop
+static inline int exceeds_bound(size_t score, size_t remaining, size_t max_distance) {
+    return score > remaining && score - remaining > max_distance;
+}
+
+// 模式串长度m（1..64），文本t，返回距离或max_distance + 1
+// Pattern length m (1..64), text t; returns the distance or max_distance + 1
+static inline size_t myers_word(const uint64_t peq[256], size_t m, const unsigned char *t, size_t n,
+                         size_t max_distance) {
+    uint64_t pv = ~(uint64_t)0;  // 初始每行比上一行大1 / Initially each row is one more than the row above
+    uint64_t mv = 0;
+    const uint64_t last = (uint64_t)1 << (m - 1);
+    size_t score = m;
+
+    for (size_t j = 0; j < n; j++) {
+        uint64_t eq = peq[t[j]];
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+
+        // 最后一行的横向差值更新分数（无分支）/ The horizontal delta at the last row updates the score (branch-free)
+        score += (size_t)((ph & last) != 0) - (size_t)((mh & last) != 0);
+
+        // 第0行每列加1，所以移入1 / Row 0 grows by 1 per column, so shift in a 1
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+
+        if (exceeds_bound(score, n - j - 1, max_distance)) {
+            return max_distance + 1;
+        }
+    }
+    return score;
+}
+
+// =====================================================================
+// 多字版本（模式串 > 64字节）/ Multi-Word Version (pattern > 64 bytes)
+// =====================================================================
+// 模式串按64行分块，每块的底行横向差值(hout)作为下一块的输入(hin)
+// The pattern is split into 64-row blocks; each block's bottom horizontal delta (hout)
+// is the next block's input (hin)
+
+static size_t myers_blocks(const unsigned char *p, size_t m, const unsigned char *t, size_t n,
+                           size_t max_distance) {
+    const size_t blocks = (m + 63) / 64;
+    // peq按[字符][块]排列，推进一列时连续访问 / peq laid out as [char][block] for sequential access per column
+    uint64_t *peq = calloc(256 * blocks, sizeof(uint64_t));
+    uint64_t *pv = malloc(blocks * sizeof(uint64_t));
+    uint64_t *mv = malloc(blocks * sizeof(uint64_t));
+    if (peq == NULL || pv == NULL || mv == NULL) {
+        free(peq);
+        free(pv);
+        free(mv);
+        return STR_DISTANCE_ERROR;
+    }
+
+    for (size_t i = 0; i < m; i++) {
+        peq[p[i] * blocks + i / 64] |= (uint64_t)1 << (i % 64);
+    }
+    for (size_t b = 0; b < blocks; b++) {
+        pv[b] = ~(uint64_t)0;
+        mv[b] = 0;
+    }
+
+    const uint64_t last = (uint64_t)1 << ((m - 1) % 64);
+    size_t score = m;
+
+    for (size_t j = 0; j < n; j++) {
+        const uint64_t *eq_col = peq + t[j] * blocks;
+        int hin = 1;
+
+        for (size_t b = 0; b < blocks; b++) {
+            uint64_t eq = eq_col[b];
+            uint64_t pv_b = pv[b], mv_b = mv[b];
+            uint64_t hin_neg = (hin < 0);
+            uint64_t xv = eq | mv_b;
+            eq |= hin_neg;
+            uint64_t xh = (((eq & pv_b) + pv_b) ^ pv_b) | eq;
+            uint64_t ph = mv_b | ~(xh | pv_b);
+            uint64_t mh = pv_b & xh;
+
+            int hout = (int)(ph >> 63) - (int)(mh >> 63);
+            if (b == blocks - 1) {
+                if (ph & last) {
+                    score++;
+                } else if (mh & last) {
+                    score--;
+                }
+            }
+
+            ph <<= 1;
+            mh <<= 1;
+            mh |= hin_neg;
+            ph |= (uint64_t)(hin > 0);
+            pv[b] = mh | ~(xv | ph);
+            mv[b] = ph & xv;
+            hin = hout;
+        }
+
+        if (exceeds_bound(score, n - j - 1, max_distance)) {
+            score = max_distance + 1;
+            break;
+        }
+    }
+
+    free(peq);
+    free(pv);
+    free(mv);
+    return score;
+}
+
+// 以较短的串为模式串 / Use the shorter string as the pattern
+static inline size_t edit_distance_impl(const char *a, size_t a_len, const char *b, size_t b_len,
+                                 size_t max_distance) {
+    if (a_len > b_len) {
+        const char *ts = a;
+        a = b;
+        b = ts;
+        size_t tl = a_len;
+        a_len = b_len;
+        b_len = tl;
+    }
+    if (b_len - a_len > max_distance) {
+        return max_distance + 1;  // 长度差是距离的下界 / The length difference is a lower bound
+    }
+    if (a_len == 0) {
+        return b_len;
+    }
+
+    const unsigned char *p = (const unsigned char *)a;
+    const unsigned char *t = (const unsigned char *)b;
+    if (a_len <= 64) {
+        uint64_t peq[256];
+        build_peq64(peq, p, a_len, t, b_len);
+        return myers_word(peq, a_len, t, b_len, max_distance);
+    }
+    return myers_blocks(p, a_len, t, b_len, max_distance);
+}
+
+// =====================================================================
+// 函数实现 / Function Implementations
+// =====================================================================
+
+// 计算编辑距离 / Compute the edit distance
+size_t str_edit_distance(const char *a, size_t a_len, const char *b, size_t b_len) {
+    return edit_distance_impl(a, a_len, b, b_len, SIZE_MAX);
+}
+
+// 带上限的编辑距离 / Bounded edit distance
+size_t str_edit_distance_bounded(const char *a, size_t a_len, const char *b, size_t b_len,
+                                 size_t max_distance) {
+    if (max_distance == SIZE_MAX) {
+        return str_edit_distance(a, a_len, b, b_len);
+    }
+    return edit_distance_impl(a, a_len, b, b_len, max_distance);
+}
+
+#if defined(__SSE2__)
+// 4个候选串并行：每个32位通道是一个候选串的Pv/Mv/分数
+// Four candidates in parallel: each 32-bit lane holds one candidate's Pv/Mv/score
+static void myers_batch4_sse2(const uint32_t peq[256], size_t m,
+                              const unsigned char *const t[4], const size_t n[4],
+                              size_t out[4]) {
+    const __m128i ones = _mm_set1_epi32(-1);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i last = _mm_set1_epi32((int)((uint32_t)1 << (m - 1)));
+    const __m128i last_shift = _mm_cvtsi32_si128((int)(m - 1));
+    const __m128i lens = _mm_set_epi32((int)n[3], (int)n[2], (int)n[1], (int)n[0]);
+    __m128i pv = ones;
+    __m128i mv = _mm_setzero_si128();
+    __m128i score = _mm_set1_epi32((int)m);
+
+    size_t max_n = n[0];
+    for (int k = 1; k < 4; k++) {
+        if (n[k] > max_n) {
+            max_n = n[k];
+        }
+    }
+
+    for (size_t j = 0; j < max_n; j++) {
+        // 已结束的通道用eq=0，其分数更新被active屏蔽
+        // Finished lanes use eq = 0, and their score updates are masked off by `active`
+        __m128i eq = _mm_set_epi32(j < n[3] ? (int)peq[t[3][j]] : 0,
+                                   j < n[2] ? (int)peq[t[2][j]] : 0,
+                                   j < n[1] ? (int)peq[t[1][j]] : 0,
+                                   j < n[0] ? (int)peq[t[0][j]] : 0);
+        __m128i active = _mm_cmpgt_epi32(lens, _mm_set1_epi32((int)j));
+
+        __m128i xv = _mm_or_si128(eq, mv);
+        __m128i sum = _mm_add_epi32(_mm_and_si128(eq, pv), pv);
+        __m128i xh = _mm_or_si128(_mm_xor_si128(sum, pv), eq);
+        __m128i ph = _mm_or_si128(mv, _mm_xor_si128(_mm_or_si128(xh, pv), ones));
+        __m128i mh = _mm_and_si128(pv, xh);
+
+        __m128i ph_bit = _mm_srl_epi32(_mm_and_si128(ph, last), last_shift);
+        __m128i mh_bit = _mm_srl_epi32(_mm_and_si128(mh, last), last_shift);
+        score = _mm_add_epi32(score, _mm_and_si128(active, _mm_sub_epi32(ph_bit, mh_bit)));
+
+        ph = _mm_or_si128(_mm_slli_epi32(ph, 1), one);
+        mh = _mm_slli_epi32(mh, 1);
+        pv = _mm_or_si128(mh, _mm_xor_si128(_mm_or_si128(xv, ph), ones));
+        mv = _mm_and_si128(ph, xv);
+    }
+
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, score);
+    for (int k = 0; k < 4; k++) {
+        out[k] = lanes[k];
+    }
+}
+#endif
+
+// 一对多批量编辑距离 / One-vs-many batch edit distance
+void str_edit_distance_batch(const char *query, size_t query_len,
+                             const char *const *candidates, const size_t *candidate_lens,
+                             size_t count, size_t *distances) {
+    if (query == NULL || candidates == NULL || distances == NULL) {
+        return;
+    }
+
+    size_t i = 0;
+    const unsigned char *q = (const unsigned char *)query;
+
+#if defined(__SSE2__)
+    if (query_len >= 1 && query_len <= 32) {
+        uint32_t peq[256];
+        memset(peq, 0, sizeof(peq));
+        for (size_t k = 0; k < query_len; k++) {
+            peq[q[k]] |= (uint32_t)1 << k;
+        }
+
+        for (; i + 4 <= count; i += 4) {
+            const unsigned char *t[4];
+            size_t n[4];
+            int fits = 1;
+            for (int k = 0; k < 4; k++) {
+                const char *c = candidates[i + k] != NULL ? candidates[i + k] : "";
+                t[k] = (const unsigned char *)c;
+                n[k] = candidate_lens != NULL ? candidate_lens[i + k] : strlen(c);
+                fits &= n[k] < ((size_t)1 << 30);  // 通道用有符号32位比较 / Lanes compare as signed 32-bit
+            }
+            if (!fits) {
+                break;
+            }
+            myers_batch4_sse2(peq, query_len, t, n, distances + i);
+        }
+    }
+#endif
+
+    // 剩余的候选串逐个计算 / Remaining candidates one at a time
+    for (; i < count; i++) {
+        const char *c = candidates[i] != NULL ? candidates[i] : "";
+        size_t n = candidate_lens != NULL ? candidate_lens[i] : strlen(c);
+        distances[i] = str_edit_distance(query, query_len, c, n);
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * 字符串编辑距离头文件 / String Edit Distance Header
+ *
+ * 用Myers位并行算法计算Levenshtein编辑距离，用于模糊匹配和去重
+ * Levenshtein edit distance via Myers' bit-parallel algorithm, for fuzzy matching and deduplication
+ */
+
+#ifndef STR_DISTANCE_H
+#define STR_DISTANCE_H
+
+#include <stddef.h>   // 用于 size_t / For size_t
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 内存分配失败时的返回值 / Returned when memory allocation fails
+#define STR_DISTANCE_ERROR ((size_t)-1)
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 计算编辑距离（插入、删除、替换各计1）/ Compute the edit distance (insert, delete, substitute cost 1)
+ *
+ * 较短字符串不超过64字节时只用一个64位字，否则按64位块分块计算（需要分配内存）
+ * One 64-bit word when the shorter string is at most 64 bytes; otherwise 64-bit blocks (allocates)
+ *
+ * @param a 第一个字符串 / First string
+ * @param a_len 第一个字符串长度 / Length of the first string
+ * @param b 第二个字符串 / Second string
+ * @param b_len 第二个字符串长度 / Length of the second string
+ * @return 编辑距离；分配失败返回STR_DISTANCE_ERROR / Edit distance; STR_DISTANCE_ERROR if allocation fails
+ */
+size_t str_edit_distance(const char *a, size_t a_len, const char *b, size_t b_len);
+
+/**
+ * 带上限的编辑距离 / Bounded edit distance
+ *
+ * 只关心"距离 <= max_distance"时使用：长度差过大直接返回，
+ * 计算过程中一旦确定超过上限立即停止
+ * Use when only "distance <= max_distance" matters: large length differences return at once,
+ * and the scan stops as soon as the bound is certainly exceeded
+ *
+ * @param max_distance 距离上限 / Distance bound
+ * @return 距离 <= max_distance 时返回精确值，否则返回 max_distance + 1
+ *         The exact distance if <= max_distance, otherwise max_distance + 1
+ */
+size_t str_edit_distance_bounded(const char *a, size_t a_len, const char *b, size_t b_len,
+                                 size_t max_distance);
+
+/**
+ * 一对多批量编辑距离 / One-vs-many batch edit distance
+ *
+ * 查询串不超过32字节时，用SSE2把4个候选串放在4个32位通道中同时计算
+ * When the query is at most 32 bytes, SSE2 runs 4 candidates at once in four 32-bit lanes
+ *
+ * @param query 查询串 / Query string
+ * @param query_len 查询串长度 / Query length
+ * @param candidates 候选串数组 / Candidate strings
+ * @param candidate_lens 候选串长度数组，为NULL时使用strlen / Candidate lengths, or NULL to use strlen
+ * @param count 候选串个数 / Number of candidates
+ * @param distances 输出：每个候选串的距离 / Output: distance for each candidate
+ */
+void str_edit_distance_batch(const char *query, size_t query_len,
+                             const char *const *candidates, const size_t *candidate_lens,
+                             size_t count, size_t *distances);
+
+#endif // STR_DISTANCE_H
@@ -0,0 +1,436 @@
+/**
+ * 通配符匹配实现文件 / Glob Matching Implementation
+ *
+ * 递归回溯的通配符匹配在 "*a*a*a*b" 这类模式上是指数级的。这里先把模式按'*'切成若干段，
+ * 每段的每个位置只匹配一个字符，所以段的长度固定。于是：
+ *   - 第一段（前面没有'*'）必须出现在开头，最后一段（后面没有'*'）必须出现在结尾
+ *   - 中间各段按顺序取最左边的出现位置即可，不需要回溯
+ * 每段用Shift-And位并行搜索（段不超过64个位置时线性，更长时O(n·words)）；纯字面段先用SSE2扫描首尾字节，
+ * 验证开销超过预算时改回Shift-And，最坏情况不比Shift-And差。
+ *
+ * Recursive backtracking glob matching is exponential on patterns like "*a*a*a*b". Here the
+ * pattern is cut at each '*' into segments; every position in a segment matches exactly one
+ * character, so segments have fixed length. Therefore:
+ *   - the first segment (no '*' before it) must sit at the start and the last segment
+ *     (no '*' after it) at the end
+ *   - the middle segments only need their leftmost occurrence, in order, with no backtracking
+ * Each segment is searched with bit-parallel Shift-And (linear for segments of at most 64
+ * positions, O(n·words) beyond that); purely literal segments first try an SSE2 scan of the
+ * first and last bytes, and fall back to Shift-And once verification exceeds a budget, so the
+ * worst case is no worse than Shift-And.
+ */
+
+#include "str_glob.h"
+#include <stdint.h>   // 用于 uint64_t / For uint64_t
+#include <stdlib.h>   // 用于 malloc, calloc, free / For malloc, calloc, free
+#include <string.h>   // 用于 memchr, memcmp, strlen / For memchr, memcmp, strlen
+
+#if defined(__SSE2__)
+#include <emmintrin.h>  // SSE2
+#endif
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 一个'*'之间的段 / One segment between '*'s
+typedef struct {
+    size_t len;              // 段长度（字符数）/ Segment length (characters)
+    size_t words;            // 每个字节的掩码字数 / Mask words per byte value
+    uint64_t *masks;         // [256][words]：第i位表示该字节匹配第i个位置 / Bit i: the byte matches position i
+    unsigned char *literal;  // 全是字面字符时的内容，否则为NULL / Bytes if all literal, else NULL
+} glob_segment_t;
+
+struct glob_pattern {
+    bool has_star;           // 模式中是否有'*' / Whether the pattern contains '*'
+    bool anchored_start;     // 第一段必须从开头匹配 / First segment must match at the start
+    bool anchored_end;       // 最后一段必须匹配到结尾 / Last segment must match at the end
+    size_t count;            // 段数 / Number of segments
+    glob_segment_t segments[];
+};
+
+// 解析出的一个位置：一个256位的字节集合 / One parsed position: a 256-bit byte set
+typedef struct {
+    uint64_t set[4];
+    int literal;             // 单个字面字节，或-1 / A single literal byte, or -1
+} glob_atom_t;
+
+// =====================================================================
+// 模式解析 / Pattern Parsing
+// =====================================================================
+
+static inline void atom_add(glob_atom_t *atom, unsigned char c) {
+    atom->set[c >> 6] |= (uint64_t)1 << (c & 63);
+}
+
+static inline bool atom_has(const glob_atom_t *atom, unsigned char c) {
+    return (atom->set[c >> 6] >> (c & 63)) & 1;
+}
+
+// 解析从p[0] == '['开始的字符集合，返回消耗的字符数；没有闭合']'时返回0
+// Parse a class starting at p[0] == '['; returns characters consumed, or 0 if there is no closing ']'
+static size_t parse_class(const unsigned char *p, glob_atom_t *atom) {
+    size_t i = 1;
+    bool negate = false;
+    if (p[i] == '!' || p[i] == '^') {
+        negate = true;
+        i++;
+    }
+
+    glob_atom_t set = {{0, 0, 0, 0}, -1};
+    bool first = true;
+    for (;;) {
+        if (p[i] == '\0') {
+            return 0;
+        }
+        if (p[i] == ']' && !first) {
+            i++;
+            break;
+        }
+        first = false;
+
+        unsigned char lo = p[i];
+        if (lo == '\\' && p[i + 1] != '\0') {
+            lo = p[++i];
+        }
+        i++;
+
+        // 范围a-z；末尾的'-'是字面字符 / Range a-z; a trailing '-' is literal
+        if (p[i] == '-' && p[i + 1] != ']' && p[i + 1] != '\0') {
+            unsigned char hi = p[i + 1];
+            i += 2;
+            if (hi == '\\' && p[i] != '\0') {
+                hi = p[i++];
+            }
+            for (unsigned c = lo; c <= hi; c++) {
+                atom_add(&set, (unsigned char)c);
+            }
+        } else {
+            atom_add(&set, lo);
+        }
+    }
+
+    for (int w = 0; w < 4; w++) {
+        atom->set[w] = negate ? ~set.set[w] : set.set[w];
+    }
+    atom->literal = -1;
+    return i;
+}
+
+// 用atoms[0..len)构造一个段 / Build a segment from atoms[0..len)
+static bool build_segment(glob_segment_t *seg, const glob_atom_t *atoms, size_t len) {
+    seg->len = len;
+    seg->words = (len + 63) / 64;
+    seg->masks = calloc(256 * seg->words, sizeof(uint64_t));
+    seg->literal = NULL;
+    if (seg->masks == NULL) {
+        return false;
+    }
+
+    bool all_literal = true;
+    for (size_t i = 0; i < len; i++) {
+        all_literal &= atoms[i].literal >= 0;
+        for (unsigned c = 0; c < 256; c++) {
+            if (atom_has(&atoms[i], (unsigned char)c)) {
+                seg->masks[c * seg->words + i / 64] |= (uint64_t)1 << (i % 64);
+            }
+        }
+    }
+
+    if (all_literal) {
+        seg->literal = malloc(len);
+        if (seg->literal == NULL) {
+            return false;
+        }
+        for (size_t i = 0; i < len; i++) {
+            seg->literal[i] = (unsigned char)atoms[i].literal;
+        }
+    }
+    return true;
+}
+
+// =====================================================================
+// 段搜索 / Segment Search
+// =====================================================================
+
+// 段是否恰好出现在t处 / Whether the segment matches exactly at t
+static bool segment_match_at(const glob_segment_t *seg, const unsigned char *t) {
+    if (seg->literal != NULL) {
+        return memcmp(t, seg->literal, seg->len) == 0;
+    }
+    for (size_t i = 0; i < seg->len; i++) {
+        if (!((seg->masks[t[i] * seg->words + i / 64] >> (i % 64)) & 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Shift-And：在t[from..end)中找段最左边的出现，返回起始位置或SIZE_MAX
+// Shift-And: leftmost occurrence of the segment in t[from..end); start index or SIZE_MAX
+static size_t shift_and_find(const glob_segment_t *seg, const unsigned char *t,
+                             size_t from, size_t end) {
+    const size_t len = seg->len;
+
+    if (seg->words == 1) {
+        const uint64_t accept = (uint64_t)1 << (len - 1);
+        uint64_t state = 0;
+        for (size_t j = from; j < end; j++) {
+            state = ((state << 1) | 1) & seg->masks[t[j]];
+            if (state & accept) {
+                return j + 1 - len;
+            }
+        }
+        return SIZE_MAX;
+    }
+
+    // 多字：低位字的最高位进位到下一个字 / Multi-word: each word's top bit carries into the next
+    const size_t words = seg->words;
+    const uint64_t accept = (uint64_t)1 << ((len - 1) % 64);
+    uint64_t local[16] = {0};
+    uint64_t *state = words <= 16 ? local : calloc(words, sizeof(uint64_t));
+    if (state == NULL) {
+        // 内存不足时退回逐位置比较 / Out of memory: fall back to checking each position
+        for (size_t j = from; j + len <= end; j++) {
+            if (segment_match_at(seg, t + j)) {
+                return j;
+            }
+        }
+        return SIZE_MAX;
+    }
+
+    size_t found = SIZE_MAX;
+    for (size_t j = from; j < end; j++) {
+        const uint64_t *mask = seg->masks + t[j] * words;
+        uint64_t carry = 1;
+        for (size_t w = 0; w < words; w++) {
+            uint64_t next_carry = state[w] >> 63;
+            state[w] = ((state[w] << 1) | carry) & mask[w];
+            carry = next_carry;
+        }
+        if (state[words - 1] & accept) {
+            found = j + 1 - len;
+            break;
+        }
+    }
+    if (state != local) {
+        free(state);
+    }
+    return found;
+}
+
+// 字面段搜索：SSE2比较首尾字节，候选位置再用memcmp确认
+// Literal search: SSE2 compares the first and last bytes, memcmp confirms candidates
+static size_t literal_find(const glob_segment_t *seg, const unsigned char *t,
+                           size_t from, size_t end) {
+    const unsigned char *lit = seg->literal;
+    const size_t len = seg->len;
+
+    if (len == 1) {
+        const unsigned char *hit = memchr(t + from, lit[0], end - from);
+        return hit != NULL ? (size_t)(hit - t) : SIZE_MAX;
+    }
+
+    // 验证预算：超出后交给Shift-And，保证线性 / Verification budget: beyond it Shift-And takes over, keeping it linear
+    size_t budget = (end - from) + 64;
+    size_t i = from;
+
+#if defined(__SSE2__)
+    const __m128i first = _mm_set1_epi8((char)lit[0]);
+    const __m128i last = _mm_set1_epi8((char)lit[len - 1]);
+    for (; i + len - 1 + 16 <= end; i += 16) {
+        __m128i block_first = _mm_loadu_si128((const __m128i *)(t + i));
+        __m128i block_last = _mm_loadu_si128((const __m128i *)(t + i + len - 1));
+        unsigned mask = (unsigned)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+        while (mask != 0) {
+            size_t pos = i + (size_t)__builtin_ctz(mask);
+            if (memcmp(t + pos + 1, lit + 1, len - 2) == 0) {
+                return pos;
+            }
+            if (budget < len) {
+                return shift_and_find(seg, t, pos, end);
+            }
+            budget -= len;
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    // 剩余部分 / The remainder
+    for (; i + len <= end; i++) {
+        if (t[i] == lit[0] && t[i + len - 1] == lit[len - 1]) {
+            if (memcmp(t + i + 1, lit + 1, len - 2) == 0) {
+                return i;
+            }
+            if (budget < len) {
+                return shift_and_find(seg, t, i, end);
+            }
+            budget -= len;
+        }
+    }
+    return SIZE_MAX;
+}
+
+static size_t segment_find(const glob_segment_t *seg, const unsigned char *t,
+                           size_t from, size_t end) {
+    if (end - from < seg->len) {
+        return SIZE_MAX;
+    }
+    if (seg->literal != NULL) {
+        return literal_find(seg, t, from, end);
+    }
+    return shift_and_find(seg, t, from, end);
+}
+
+// =====================================================================
+// 函数实现 / Function Implementations
+// =====================================================================
+
+// 编译通配符模式 / Compile a glob pattern
+glob_pattern_t* glob_compile(const char *pattern) {
+    if (pattern == NULL) {
+        return NULL;
+    }
+
+    // 每个位置至少消耗一个模式字符，所以strlen是上限
+    // Each position consumes at least one pattern character, so strlen is an upper bound
+    size_t plen = strlen(pattern);
+    glob_atom_t *atoms = malloc((plen + 1) * sizeof(glob_atom_t));
+    size_t *seg_ends = malloc((plen + 2) * sizeof(size_t));
+    glob_pattern_t *glob = calloc(1, sizeof(glob_pattern_t) + (plen + 1) * sizeof(glob_segment_t));
+    if (atoms == NULL || seg_ends == NULL || glob == NULL) {
+        free(atoms);
+        free(seg_ends);
+        free(glob);
+        return NULL;
+    }
+
+    const unsigned char *p = (const unsigned char *)pattern;
+    size_t natoms = 0, nsegs = 0, seg_start = 0;
+    bool ends_with_star = false;
+    glob->anchored_start = p[0] != '*';
+
+    for (size_t i = 0; p[i] != '\0';) {
+        if (p[i] == '*') {
+            glob->has_star = true;
+            ends_with_star = true;
+            if (natoms > seg_start) {
+                seg_ends[nsegs++] = natoms;
+                seg_start = natoms;
+            }
+            i++;
+            continue;
+        }
+
+        glob_atom_t *atom = &atoms[natoms];
+        size_t class_len;
+        memset(atom, 0, sizeof(*atom));
+        atom->literal = -1;
+        ends_with_star = false;
+        if (p[i] == '?') {
+            atom->set[0] = atom->set[1] = atom->set[2] = atom->set[3] = ~(uint64_t)0;
+            i++;
+        } else if (p[i] == '[' && (class_len = parse_class(p + i, atom)) > 0) {
+            i += class_len;
+        } else {
+            unsigned char c = p[i];
+            if (c == '\\' && p[i + 1] != '\0') {
+                c = p[++i];
+            }
+            atom_add(atom, c);
+            atom->literal = c;
+            i++;
+        }
+        natoms++;
+    }
+    if (natoms > seg_start) {
+        seg_ends[nsegs++] = natoms;
+    }
+    glob->anchored_end = !ends_with_star;
+
+    bool ok = true;
+    size_t begin = 0;
+    for (size_t s = 0; s < nsegs && ok; s++) {
+        ok = build_segment(&glob->segments[s], atoms + begin, seg_ends[s] - begin);
+        glob->count = s + 1;
+        begin = seg_ends[s];
+    }
+
+    free(atoms);
+    free(seg_ends);
+    if (!ok) {
+        glob_free(glob);
+        return NULL;
+    }
+    return glob;
+}
+
+// 匹配指定长度的字符串 / Match a string of known length
+bool glob_match_n(const glob_pattern_t *glob, const char *str, size_t len) {
+    if (glob == NULL || str == NULL) {
+        return false;
+    }
+
+    const unsigned char *t = (const unsigned char *)str;
+    const glob_segment_t *seg = glob->segments;
+    size_t first = 0, last = glob->count;
+    size_t pos = 0, end = len;
+
+    // 没有'*'：整个字符串就是一段 / No '*': the whole string is one segment
+    if (!glob->has_star) {
+        if (glob->count == 0) {
+            return len == 0;
+        }
+        return len == seg[0].len && segment_match_at(&seg[0], t);
+    }
+
+    // 开头固定的段 / Segment anchored at the start
+    if (glob->anchored_start && first < last) {
+        if (len < seg[first].len || !segment_match_at(&seg[first], t)) {
+            return false;
+        }
+        pos = seg[first].len;
+        first++;
+    }
+
+    // 结尾固定的段，不能与开头的段重叠 / Segment anchored at the end, not overlapping the start
+    if (glob->anchored_end && first < last) {
+        const glob_segment_t *tail = &seg[last - 1];
+        if (len - pos < tail->len || !segment_match_at(tail, t + len - tail->len)) {
+            return false;
+        }
+        end = len - tail->len;
+        last--;
+    }
+
+    // 中间各段取最左边的出现 / Leftmost occurrence of each middle segment
+    for (size_t s = first; s < last; s++) {
+        size_t at = segment_find(&seg[s], t, pos, end);
+        if (at == SIZE_MAX) {
+            return false;
+        }
+        pos = at + seg[s].len;
+    }
+    return true;
+}
+
+// 匹配整个字符串 / Match a whole string
+bool glob_match(const glob_pattern_t *glob, const char *str) {
+    if (str == NULL) {
+        return false;
+    }
+    return glob_match_n(glob, str, strlen(str));
+}
+
+// 释放编译后的模式 / Free a compiled pattern
+void glob_free(glob_pattern_t *glob) {
+    if (glob == NULL) {
+        return;
+    }
+    for (size_t s = 0; s < glob->count; s++) {
+        free(glob->segments[s].masks);
+        free(glob->segments[s].literal);
+    }
+    free(glob);
+}
@@ -0,0 +1,72 @@
+/**
+ * 通配符匹配头文件 / Glob Matching Header
+ *
+ * 把 `*`、`?`、`[...]` 模式预编译后重复匹配。每段不超过64个位置时任何输入都是线性时间，
+ * 更长的段用多字Shift-And，时间为O(n·words)，words = ceil(段长/64)
+ * Compile `*`, `?` and `[...]` patterns once and match repeatedly. Matching is linear on any input
+ * while every segment has at most 64 positions; longer segments use multi-word Shift-And, which is
+ * O(n·words) with words = ceil(segment length / 64)
+ */
+
+#ifndef STR_GLOB_H
+#define STR_GLOB_H
+
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdbool.h>  // 用于 bool / For bool
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 编译后的模式（不透明类型）/ Compiled pattern (opaque type)
+typedef struct glob_pattern glob_pattern_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 编译通配符模式 / Compile a glob pattern
+ *
+ * 语法 / Syntax:
+ *   *       任意长度（含0）的任意字符，包括'/' / Any run of characters (including none), '/' included
+ *   ?       任意一个字符 / Any single character
+ *   [abc]   集合中的一个字符，支持范围 [a-z] / One character from the set; ranges like [a-z]
+ *   [!abc]  不在集合中的一个字符（也可写 [^abc]）/ One character not in the set (also [^abc])
+ *   \x      字面字符x / The literal character x
+ * 没有闭合']'的'['按字面字符处理（与fnmatch相同）
+ * A '[' without a closing ']' is a literal character (as in fnmatch)
+ * 模式末尾单独的'\'匹配字面反斜杠；fnmatch把这样的模式视为无效，永远不匹配
+ * A lone '\' at the end of the pattern matches a literal backslash; fnmatch treats such a pattern
+ * as invalid and never matches it
+ *
+ * @param pattern 模式字符串 / Pattern string
+ * @return 编译后的模式，内存分配失败返回NULL；用glob_free释放
+ *         Compiled pattern, or NULL if allocation fails; release with glob_free
+ */
+glob_pattern_t* glob_compile(const char *pattern);
+
+/**
+ * 匹配整个字符串 / Match a whole string
+ * @param glob 编译后的模式 / Compiled pattern
+ * @param str 字符串 / String
+ * @return 整个字符串匹配时返回true / true if the whole string matches
+ */
+bool glob_match(const glob_pattern_t *glob, const char *str);
+
+/**
+ * 匹配指定长度的字符串（可以包含'\0'）/ Match a string of known length (may contain '\0')
+ * @param glob 编译后的模式 / Compiled pattern
+ * @param str 字符串 / String
+ * @param len 字符串长度 / String length
+ * @return 整个字符串匹配时返回true / true if the whole string matches
+ */
+bool glob_match_n(const glob_pattern_t *glob, const char *str, size_t len);
+
+/**
+ * 释放编译后的模式 / Free a compiled pattern
+ * @param glob 编译后的模式，可以为NULL / Compiled pattern, may be NULL
+ */
+void glob_free(glob_pattern_t *glob);
+
+#endif // STR_GLOB_H
@@ -0,0 +1,242 @@
+/**
+ * 字符串驻留实现文件 / String Interning Implementation
+ *
+ * 字符串内容保存在内存区域中（指针稳定，不随哈希表扩容移动），
+ * 哈希表用线性探测的开放寻址，每个槽16字节，保存哈希值和长度以便快速排除不相等的键。
+ *
+ * String bytes live in an arena (stable pointers that never move when the table grows);
+ * the hash table uses linear-probing open addressing with 16-byte slots holding the hash and
+ * length, so unequal keys are rejected without touching the string bytes.
+ */
+
+#include "str_intern.h"
+#include "hash.h"     // 用于 hash64 / For hash64
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stdlib.h>   // 用于 calloc, free / For calloc, free
+#include <string.h>   // 用于 memcmp, strlen / For memcmp, strlen
+
+// 初始槽数 / Initial number of slots
+#define INTERN_INITIAL_CAPACITY 64
+
+// 批量驻留每组的个数 / Strings per group in bulk interning
+#define INTERN_BULK_GROUP 64
+
+// 预取距离（槽）/ Prefetch distance (in keys)
+#define INTERN_PREFETCH_DISTANCE 8
+
+#if defined(__GNUC__)
+#define INTERN_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define INTERN_PREFETCH(p) ((void)(p))
+#endif
+
+// =====================================================================
+// 哈希表 / Hash Table
+// =====================================================================
+
+static inline uint32_t intern_hash(const char *str, size_t len) {
+    return (uint32_t)hash64(str, len, HASH_DEFAULT_SEED);
+}
+
+// 扩容到new_capacity个槽；字符串不移动，只重新放置槽
+// Grow to new_capacity slots; strings stay put, only slots are re-placed
+static bool intern_grow(intern_pool_t *pool, size_t new_capacity) {
+    intern_slot_t *slots = calloc(new_capacity, sizeof(intern_slot_t));
+    if (slots == NULL) {
+        return false;
+    }
+    size_t mask = new_capacity - 1;
+    for (size_t i = 0; i < pool->capacity; i++) {
+        const intern_slot_t *old = &pool->slots[i];
+        if (old->str != NULL) {
+            size_t j = old->hash & mask;
+            while (slots[j].str != NULL) {
+                j = (j + 1) & mask;
+            }
+            slots[j] = *old;
+        }
+    }
+    free(pool->slots);
+    pool->slots = slots;
+    pool->capacity = new_capacity;
+    return true;
+}
+
+// 保证再插入extra个键后负载因子不超过1/2 / Keep the load factor at most 1/2 after extra more keys
+static bool intern_reserve(intern_pool_t *pool, size_t extra) {
+    size_t needed = (pool->count + extra) * 2;
+    if (needed <= pool->capacity) {
+        return true;
+    }
+    size_t capacity = pool->capacity != 0 ? pool->capacity : INTERN_INITIAL_CAPACITY;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+    return intern_grow(pool, capacity);
+}
+
+// 查找键，返回匹配的槽或应插入的空槽 / Find a key: the matching slot or the empty slot to fill
+static intern_slot_t* intern_find_slot(const intern_pool_t *pool, const char *str,
+                                       uint32_t len, uint32_t hash) {
+    size_t mask = pool->capacity - 1;
+    size_t i = hash & mask;
+    for (;;) {
+        intern_slot_t *slot = &pool->slots[i];
+        if (slot->str == NULL ||
+            (slot->hash == hash && slot->len == len && memcmp(slot->str, str, len) == 0)) {
+            return slot;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+// 已知哈希值时驻留（调用前已保证容量）/ Intern with a known hash (capacity already reserved)
+static const char* intern_with_hash(intern_pool_t *pool, const char *str, uint32_t len,
+                                    uint32_t hash) {
+    intern_slot_t *slot = intern_find_slot(pool, str, len, hash);
+    pool->requests++;
+    pool->bytes_requested += (size_t)len + 1;
+    if (slot->str != NULL) {
+        return slot->str;
+    }
+
+    char *copy = arena_strndup(&pool->arena, str, len);
+    if (copy == NULL) {
+        pool->requests--;
+        pool->bytes_requested -= (size_t)len + 1;
+        return NULL;
+    }
+    slot->str = copy;
+    slot->hash = hash;
+    slot->len = len;
+    pool->count++;
+    pool->bytes_stored += (size_t)len + 1;
+    return copy;
+}
+
+// =====================================================================
+// 函数实现 / Function Implementations
+// =====================================================================
+
+// 初始化驻留池 / Initialize an interning pool
+void intern_init(intern_pool_t *pool) {
+    if (pool == NULL) {
+        return;
+    }
+    arena_init(&pool->arena, 0);
+    pool->slots = NULL;
+    pool->capacity = 0;
+    pool->count = 0;
+    pool->requests = 0;
+    pool->bytes_requested = 0;
+    pool->bytes_stored = 0;
+}
+
+// 驻留字符串 / Intern a string
+const char* intern_strn(intern_pool_t *pool, const char *str, size_t len) {
+    if (pool == NULL || str == NULL || len > UINT32_MAX) {
+        return NULL;
+    }
+    if (!intern_reserve(pool, 1)) {
+        return NULL;
+    }
+    return intern_with_hash(pool, str, (uint32_t)len, intern_hash(str, len));
+}
+
+// 驻留以'\0'结尾的字符串 / Intern a '\0'-terminated string
+const char* intern_str(intern_pool_t *pool, const char *str) {
+    if (str == NULL) {
+        return NULL;
+    }
+    return intern_strn(pool, str, strlen(str));
+}
+
+// 批量驻留 / Intern in bulk
+size_t intern_bulk(intern_pool_t *pool, const char *const *strs, const size_t *lens,
+                   size_t count, const char **out) {
+    if (pool == NULL || strs == NULL || out == NULL) {
+        return 0;
+    }
+
+    uint32_t hashes[INTERN_BULK_GROUP];
+    uint32_t lengths[INTERN_BULK_GROUP];
+    size_t done = 0;
+
+    for (size_t base = 0; base < count; base += INTERN_BULK_GROUP) {
+        size_t n = count - base < INTERN_BULK_GROUP ? count - base : INTERN_BULK_GROUP;
+        // 先为整组预留容量，组内不会扩容，预取的地址保持有效
+        // Reserve for the whole group first so the table cannot move while prefetched
+        if (!intern_reserve(pool, n)) {
+            return done;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            const char *s = strs[base + i];
+            if (s == NULL) {
+                lengths[i] = 0;
+                hashes[i] = 0;
+                continue;
+            }
+            size_t len = lens != NULL ? lens[base + i] : strlen(s);
+            if (len > UINT32_MAX) {
+                return done;
+            }
+            lengths[i] = (uint32_t)len;
+            hashes[i] = intern_hash(s, len);
+        }
+
+        size_t mask = pool->capacity - 1;
+        for (size_t i = 0; i < n && i < INTERN_PREFETCH_DISTANCE; i++) {
+            INTERN_PREFETCH(&pool->slots[hashes[i] & mask]);
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (i + INTERN_PREFETCH_DISTANCE < n) {
+                INTERN_PREFETCH(&pool->slots[hashes[i + INTERN_PREFETCH_DISTANCE] & mask]);
+            }
+            // 和intern_str一致，NULL输入得到NULL / Like intern_str, a NULL input gives NULL
+            if (strs[base + i] == NULL) {
+                out[base + i] = NULL;
+                done++;
+                continue;
+            }
+            out[base + i] = intern_with_hash(pool, strs[base + i], lengths[i], hashes[i]);
+            if (out[base + i] == NULL) {
+                return done;
+            }
+            done++;
+        }
+    }
+    return done;
+}
+
+// 查找已驻留的字符串 / Look up an interned string
+const char* intern_lookup(const intern_pool_t *pool, const char *str, size_t len) {
+    if (pool == NULL || str == NULL || len > UINT32_MAX || pool->capacity == 0) {
+        return NULL;
+    }
+    const intern_slot_t *slot = intern_find_slot(pool, str, (uint32_t)len, intern_hash(str, len));
+    return slot->str;
+}
+
+// 获取内存统计 / Get memory statistics
+void intern_get_stats(const intern_pool_t *pool, intern_stats_t *stats) {
+    if (pool == NULL || stats == NULL) {
+        return;
+    }
+    stats->unique = pool->count;
+    stats->requests = pool->requests;
+    stats->bytes_requested = pool->bytes_requested;
+    stats->bytes_stored = pool->bytes_stored;
+    stats->bytes_saved = pool->bytes_requested - pool->bytes_stored;
+    stats->memory_used = pool->arena.reserved + pool->capacity * sizeof(intern_slot_t);
+}
+
+// 释放驻留池 / Free the pool
+void intern_free(intern_pool_t *pool) {
+    if (pool == NULL) {
+        return;
+    }
+    arena_free(&pool->arena);
+    free(pool->slots);
+    intern_init(pool);
+}
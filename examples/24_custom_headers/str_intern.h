@@ -0,0 +1,119 @@
+/**
+ * 字符串驻留头文件 / String Interning Header
+ *
+ * 相同内容的字符串只保存一份，返回稳定的规范指针：相等比较变成指针比较
+ * Equal strings are stored once behind a stable canonical pointer: equality becomes pointer comparison
+ */
+
+#ifndef STR_INTERN_H
+#define STR_INTERN_H
+
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdint.h>   // 用于 uint32_t / For uint32_t
+#include "arena.h"    // 用于 arena_t / For arena_t
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 哈希表的一个槽 / One hash table slot
+typedef struct {
+    const char *str;        // 规范指针，NULL表示空槽 / Canonical pointer, NULL for an empty slot
+    uint32_t hash;          // 哈希值的低32位 / Low 32 bits of the hash
+    uint32_t len;           // 字符串长度 / String length
+} intern_slot_t;
+
+// 驻留池 / Interning pool
+typedef struct {
+    arena_t arena;          // 字符串存储 / String storage
+    intern_slot_t *slots;   // 开放寻址哈希表 / Open-addressing hash table
+    size_t capacity;        // 槽数（2的幂）/ Number of slots (a power of two)
+    size_t count;           // 不同字符串的个数 / Number of distinct strings
+    size_t requests;        // 驻留请求总数 / Total intern requests
+    size_t bytes_requested; // 每次请求都复制时需要的字节数 / Bytes needed if every request made a copy
+    size_t bytes_stored;    // 实际保存的字符串字节数 / String bytes actually stored
+} intern_pool_t;
+
+// 内存统计 / Memory statistics
+typedef struct {
+    size_t unique;          // 不同字符串个数 / Distinct strings
+    size_t requests;        // 请求总数 / Total requests
+    size_t bytes_requested; // 每次都复制的字节数（含'\0'）/ Bytes if every request copied (with '\0')
+    size_t bytes_stored;    // 实际保存的字节数（含'\0'）/ Bytes actually stored (with '\0')
+    size_t bytes_saved;     // 节省的字符串字节数 / String bytes saved
+    size_t memory_used;     // 内存区域与哈希表的总占用 / Total footprint of arena and table
+} intern_stats_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 初始化驻留池 / Initialize an interning pool
+ * @param pool 驻留池 / Pool
+ */
+void intern_init(intern_pool_t *pool);
+
+/**
+ * 驻留字符串 / Intern a string
+ *
+ * 返回的指针在intern_free之前一直有效，内容以'\0'结尾，不能修改；
+ * 内容相同的字符串总是得到同一个指针
+ * The pointer stays valid until intern_free, is '\0'-terminated and must not be modified;
+ * equal strings always get the same pointer
+ *
+ * @param pool 驻留池 / Pool
+ * @param str 字符串（可以不以'\0'结尾）/ String (need not be '\0'-terminated)
+ * @param len 长度（最大UINT32_MAX）/ Length (at most UINT32_MAX)
+ * @return 规范指针，内存不足返回NULL / Canonical pointer, or NULL when out of memory
+ */
+const char* intern_strn(intern_pool_t *pool, const char *str, size_t len);
+
+/**
+ * 驻留以'\0'结尾的字符串 / Intern a '\0'-terminated string
+ * @param pool 驻留池 / Pool
+ * @param str 字符串 / String
+ * @return 规范指针，失败返回NULL / Canonical pointer, or NULL on failure
+ */
+const char* intern_str(intern_pool_t *pool, const char *str);
+
+/**
+ * 批量驻留 / Intern in bulk
+ *
+ * 先计算全部哈希，再在访问每个槽之前预取后面的槽，隐藏哈希表的缓存未命中
+ * Hashes everything first, then prefetches upcoming slots before touching each one,
+ * hiding the hash table's cache misses
+ *
+ * @param pool 驻留池 / Pool
+ * @param strs 字符串数组 / Strings
+ * @param lens 长度数组，为NULL时使用strlen / Lengths, or NULL to use strlen
+ * @param count 个数 / Count
+ * @param out 输出：规范指针，NULL输入对应NULL / Output: canonical pointers, NULL for a NULL input
+ * @return 处理完的个数（等于count表示全部成功）/ Number handled (count means all succeeded)
+ */
+size_t intern_bulk(intern_pool_t *pool, const char *const *strs, const size_t *lens,
+                   size_t count, const char **out);
+
+/**
+ * 查找已驻留的字符串（不插入）/ Look up an interned string (no insertion)
+ * @param pool 驻留池 / Pool
+ * @param str 字符串 / String
+ * @param len 长度 / Length
+ * @return 规范指针，未驻留返回NULL / Canonical pointer, or NULL if not interned
+ */
+const char* intern_lookup(const intern_pool_t *pool, const char *str, size_t len);
+
+/**
+ * 获取内存统计 / Get memory statistics
+ * @param pool 驻留池 / Pool
+ * @param stats 输出 / Output
+ */
+void intern_get_stats(const intern_pool_t *pool, intern_stats_t *stats);
+
+/**
+ * 释放驻留池（所有规范指针失效）/ Free the pool (every canonical pointer becomes invalid)
+ * @param pool 驻留池 / Pool
+ */
+void intern_free(intern_pool_t *pool);
+
+#endif // STR_INTERN_H
@@ -0,0 +1,44 @@
+/**
+ * 字符串数值解析头文件 / String Number Parsing Header
+ *
+ * 提供与区域设置无关、正确舍入的浮点数解析
+ * Provides locale-independent, correctly rounded floating-point parsing
+ */
+
+#ifndef STR_PARSE_H
+#define STR_PARSE_H
+
+#include <stddef.h>   // 用于 size_t / For size_t
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 解析双精度浮点数 / Parse a double-precision floating-point number
+ *
+ * 与strtod/fscanf("%f")不同：输入由指针+长度给出，无需以'\0'结尾；
+ * 小数点始终为'.'，不受setlocale影响；不跳过前导空白。
+ * 结果总是正确舍入（round-to-nearest-even）。
+ *
+ * Unlike strtod/fscanf("%f"): input is pointer + length and need not be
+ * '\0'-terminated; the decimal point is always '.', regardless of setlocale;
+ * leading whitespace is not skipped. The result is always correctly rounded
+ * (round-to-nearest-even).
+ *
+ * 支持格式 / Accepted syntax:
+ *   [+-] digits [. digits] [(e|E) [+-] digits]
+ *   [+-] inf | infinity | nan   (不区分大小写 / case-insensitive)
+ *
+ * 溢出时返回±inf并将errno设为ERANGE
+ * On overflow returns ±inf and sets errno to ERANGE
+ *
+ * @param str 输入缓冲区 / Input buffer
+ * @param len 缓冲区长度 / Buffer length
+ * @param result 结果指针 / Result pointer
+ * @return 成功返回已解析部分之后的位置，失败返回NULL
+ *         Returns pointer past the parsed number on success, NULL on failure
+ */
+const char* str_parse_double(const char *str, size_t len, double *result);
+
+#endif // STR_PARSE_H
@@ -0,0 +1,316 @@
+/**
+ * 字符串排序实现文件 / String Sorting Implementation
+ *
+ * 多键快速排序（Bentley-Sedgewick）按8字节一组处理：元素是{前缀, 键指针}，前缀把字符串从depth开始的
+ * 8个字节按大端序装进uint64_t，字符串结束后补0，所以整数大小顺序就是字节序。按前缀三路划分后，
+ * 等于组如果前缀中字符串还没结束，就前进8个字节、重新装载前缀后继续排序；小于组和大于组保持原深度。
+ *
+ * Multikey quicksort (Bentley-Sedgewick) taken 8 bytes at a time: elements are {prefix, key pointer},
+ * where the prefix packs the 8 bytes of the string from depth into a uint64_t in big-endian order,
+ * zero-padded past the end, so integer order is byte order. After a three-way partition on the
+ * prefix, the equal group advances 8 bytes and reloads its prefixes if its strings have not ended;
+ * the less and greater groups stay at the same depth.
+ *
+ * 大数组先按前缀逐字节做MSD基数排序，桶足够小后再交给多键快速排序。
+ * Large arrays first go through MSD radix passes over the prefix bytes, handing buckets to
+ * multikey quicksort once they are small enough.
+ */
+
+#include "str_sort.h"
+#include <stdint.h>   // 用于 uint64_t / For uint64_t
+#include <stdlib.h>   // 用于 malloc, free / For malloc, free
+#include <string.h>   // 用于 strcmp, strlen / For strcmp, strlen
+
+// 小于此大小的子数组用插入排序 / Subarrays smaller than this use insertion sort
+#define SORT_INSERTION_THRESHOLD 16
+
+// 大于此大小的子数组先做基数排序 / Subarrays larger than this go through radix passes first
+#define SORT_RADIX_THRESHOLD 4096
+
+// 排序元素 / Sort element
+typedef struct {
+    uint64_t prefix;        // 键从depth开始的8字节（大端序）/ 8 bytes of the key from depth (big-endian)
+    const char *key;        // 排序键 / Sort key
+} sort_item_t;
+
+// 装载从s开始的8字节前缀，字符串结束后补0 / Load the 8-byte prefix at s, zero-padded past the end
+static inline uint64_t load_prefix(const char *s) {
+    uint64_t prefix = 0;
+    for (int i = 0; i < 8; i++) {
+        unsigned char c = (unsigned char)s[i];
+        if (c == 0) {
+            break;
+        }
+        prefix |= (uint64_t)c << (56 - 8 * i);
+    }
+    return prefix;
+}
+
+// 最低字节为0说明字符串在这8个字节内结束 / A zero low byte means the string ends within these 8 bytes
+static inline bool prefix_ends(uint64_t prefix) {
+    return (prefix & 0xFF) == 0;
+}
+
+// 比较两个元素（键在depth之前相同）/ Compare two elements (keys equal before depth)
+static inline int item_compare(const sort_item_t *a, const sort_item_t *b, size_t depth) {
+    if (a->prefix != b->prefix) {
+        return a->prefix < b->prefix ? -1 : 1;
+    }
+    if (prefix_ends(a->prefix)) {
+        return 0;
+    }
+    return strcmp(a->key + depth + 8, b->key + depth + 8);
+}
+
+static void insertion_sort(sort_item_t *a, size_t n, size_t depth) {
+    for (size_t i = 1; i < n; i++) {
+        sort_item_t item = a[i];
+        size_t j = i;
+        while (j > 0 && item_compare(&item, &a[j - 1], depth) < 0) {
+            a[j] = a[j - 1];
+            j--;
+        }
+        a[j] = item;
+    }
+}
+
+static inline uint64_t median3(uint64_t a, uint64_t b, uint64_t c) {
+    if (a < b) {
+        return b < c ? b : (a < c ? c : a);
+    }
+    return a < c ? a : (b < c ? c : b);
+}
+
+static inline void swap_items(sort_item_t *a, sort_item_t *b) {
+    sort_item_t t = *a;
+    *a = *b;
+    *b = t;
+}
+
+// 多键快速排序 / Multikey quicksort
+static void multikey_sort(sort_item_t *a, size_t n, size_t depth) {
+    while (n > SORT_INSERTION_THRESHOLD) {
+        uint64_t pivot = median3(a[0].prefix, a[n / 2].prefix, a[n - 1].prefix);
+
+        // 三路划分：[0, lt) < pivot, [lt, gt) == pivot, [gt, n) > pivot
+        // Three-way partition: [0, lt) < pivot, [lt, gt) == pivot, [gt, n) > pivot
+        size_t lt = 0, i = 0, gt = n;
+        while (i < gt) {
+            uint64_t p = a[i].prefix;
+            if (p < pivot) {
+                swap_items(&a[lt++], &a[i++]);
+            } else if (p > pivot) {
+                swap_items(&a[i], &a[--gt]);
+            } else {
+                i++;
+            }
+        }
+
+        // 等于组前进8个字节 / The equal group moves 8 bytes deeper
+        size_t less = lt, equal = gt - lt, greater = n - gt;
+        bool deeper = equal > 1 && !prefix_ends(pivot);
+        if (deeper) {
+            for (size_t k = lt; k < gt; k++) {
+                a[k].prefix = load_prefix(a[k].key + depth + 8);
+            }
+        }
+
+        // 递归较小的两部分，循环处理最大的部分，栈深度为O(log n)，与公共前缀长度无关
+        // Recurse into the two smaller parts and loop on the largest, keeping the stack O(log n) whatever
+        // the length of a shared prefix
+        if (deeper && equal >= less && equal >= greater) {
+            multikey_sort(a, less, depth);
+            multikey_sort(a + gt, greater, depth);
+            a += lt;
+            n = equal;
+            depth += 8;
+        } else if (less >= greater) {
+            if (deeper) {
+                multikey_sort(a + lt, equal, depth + 8);
+            }
+            multikey_sort(a + gt, greater, depth);
+            n = less;
+        } else {
+            if (deeper) {
+                multikey_sort(a + lt, equal, depth + 8);
+            }
+            multikey_sort(a, less, depth);
+            a += gt;
+            n = greater;
+        }
+    }
+    insertion_sort(a, n, depth);
+}
+
+// 桶进入下一个字节：第8个字节之后前进8个字节并重新装载前缀
+// Move a bucket on to the next byte: past the 8th byte, advance 8 bytes and reload the prefixes
+static int next_byte(sort_item_t *a, size_t n, size_t *depth, int byte) {
+    if (byte < 7) {
+        return byte + 1;
+    }
+    for (size_t k = 0; k < n; k++) {
+        a[k].prefix = load_prefix(a[k].key + *depth + 8);
+    }
+    *depth += 8;
+    return 0;
+}
+
+// MSD基数排序：按前缀的第byte个字节分桶，只读写元素数组，不跟随指针
+// MSD radix sort: bucket by byte number `byte` of the prefix, touching only the element arrays
+static void radix_sort(sort_item_t *a, sort_item_t *tmp, size_t n, size_t depth, int byte) {
+    while (n > SORT_RADIX_THRESHOLD) {
+        int shift = 56 - 8 * byte;
+        size_t counts[256] = {0};
+        for (size_t i = 0; i < n; i++) {
+            counts[(a[i].prefix >> shift) & 0xFF]++;
+        }
+        size_t offsets[256];
+        size_t sum = 0;
+        for (int b = 0; b < 256; b++) {
+            offsets[b] = sum;
+            sum += counts[b];
+        }
+        for (size_t i = 0; i < n; i++) {
+            tmp[offsets[(a[i].prefix >> shift) & 0xFF]++] = a[i];
+        }
+        memcpy(a, tmp, n * sizeof(sort_item_t));
+
+        // 递归较小的桶，循环处理最大的桶，栈深度为O(log n)，与公共前缀长度无关
+        // Recurse into the smaller buckets and loop on the largest, keeping the stack O(log n) whatever
+        // the length of a shared prefix
+        int largest = 1;
+        for (int b = 2; b < 256; b++) {
+            if (counts[b] > counts[largest]) {
+                largest = b;
+            }
+        }
+        // 所有元素都在同一个桶里（公共前缀）时，多键快速排序前进得更快
+        // When every item lands in one bucket (a shared prefix), multikey quicksort advances faster
+        if (counts[largest] == n) {
+            break;
+        }
+
+        // 桶0中的字符串已经结束，彼此相等 / Strings in bucket 0 have ended and are all equal
+        size_t start = counts[0];
+        sort_item_t *next = a;
+        for (int b = 1; b < 256; b++) {
+            size_t size = counts[b];
+            sort_item_t *bucket = a + start;
+            start += size;
+            if (b == largest) {
+                next = bucket;
+                continue;
+            }
+            if (size < 2) {
+                continue;
+            }
+            if (size <= SORT_RADIX_THRESHOLD) {
+                multikey_sort(bucket, size, depth);
+            } else {
+                size_t bucket_depth = depth;
+                int bucket_byte = next_byte(bucket, size, &bucket_depth, byte);
+                radix_sort(bucket, tmp, size, bucket_depth, bucket_byte);
+            }
+        }
+        n = counts[largest];
+        a = next;
+        if (n > SORT_RADIX_THRESHOLD) {
+            byte = next_byte(a, n, &depth, byte);
+        }
+    }
+    if (n > 1) {
+        multikey_sort(a, n, depth);
+    }
+}
+
+// 排序元素数组 / Sort an element array
+static void sort_items(sort_item_t *items, size_t count) {
+    sort_item_t *tmp = NULL;
+    if (count > SORT_RADIX_THRESHOLD) {
+        tmp = malloc(count * sizeof(sort_item_t));
+    }
+    // 临时数组分配失败时只用多键快速排序 / Without the scratch array, multikey quicksort alone
+    if (tmp != NULL) {
+        radix_sort(items, tmp, count, 0, 0);
+        free(tmp);
+    } else {
+        multikey_sort(items, count, 0);
+    }
+}
+
+// 按字节序排序 / Sort in byte order
+bool str_sort(const char **strs, size_t count) {
+    if (strs == NULL || count < 2) {
+        return strs != NULL || count == 0;
+    }
+    if (count > SIZE_MAX / sizeof(sort_item_t)) {
+        return false;
+    }
+    sort_item_t *items = malloc(count * sizeof(sort_item_t));
+    if (items == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        items[i].prefix = load_prefix(strs[i]);
+        items[i].key = strs[i];
+    }
+    sort_items(items, count);
+    for (size_t i = 0; i < count; i++) {
+        strs[i] = items[i].key;
+    }
+    free(items);
+    return true;
+}
+
+// 忽略ASCII大小写排序 / Sort ignoring ASCII case
+bool str_sort_icase(const char **strs, size_t count) {
+    if (strs == NULL || count < 2) {
+        return strs != NULL || count == 0;
+    }
+    if (count > SIZE_MAX / sizeof(sort_item_t)) {
+        return false;
+    }
+
+    // 每个键前面放原字符串指针，按指针大小对齐：[原指针][小写键'\0'][填充]
+    // Each key is preceded by its original pointer, aligned to pointer size: [orig][lowercase key '\0'][pad]
+    const size_t align = sizeof(const char *);
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t entry = align + strlen(strs[i]) + 1;
+        entry = (entry + align - 1) & ~(align - 1);
+        if (entry > SIZE_MAX - total) {
+            return false;
+        }
+        total += entry;
+    }
+    sort_item_t *items = malloc(count * sizeof(sort_item_t));
+    char *keys = malloc(total);
+    if (items == NULL || keys == NULL) {
+        free(items);
+        free(keys);
+        return false;
+    }
+
+    char *pos = keys;
+    for (size_t i = 0; i < count; i++) {
+        memcpy(pos, &strs[i], sizeof(const char *));
+        char *key = pos + align;
+        size_t len = 0;
+        for (const unsigned char *s = (const unsigned char *)strs[i]; s[len] != 0; len++) {
+            unsigned char c = s[len];
+            key[len] = (char)((unsigned char)(c - 'A') < 26 ? c | 0x20 : c);
+        }
+        key[len] = '\0';
+        items[i].prefix = load_prefix(key);
+        items[i].key = key;
+        pos += (align + len + 1 + align - 1) & ~(align - 1);
+    }
+
+    sort_items(items, count);
+    for (size_t i = 0; i < count; i++) {
+        memcpy(&strs[i], items[i].key - align, sizeof(const char *));
+    }
+    free(items);
+    free(keys);
+    return true;
+}
@@ -0,0 +1,46 @@
+/**
+ * 字符串排序头文件 / String Sorting Header
+ *
+ * 多键快速排序：每个元素缓存字符串当前位置的8字节前缀，大部分比较只是整数比较，不用跟随指针
+ * Multikey quicksort: each element caches an 8-byte prefix of its string at the current depth, so
+ * most comparisons are integer compares that never follow the pointer
+ */
+
+#ifndef STR_SORT_H
+#define STR_SORT_H
+
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stddef.h>   // 用于 size_t / For size_t
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 按字节序排序（与qsort + strcmp结果相同）/ Sort in byte order (same result as qsort + strcmp)
+ *
+ * 大数组先按前缀做MSD基数排序再交给多键快速排序；每个字符串最多需要32字节临时内存
+ * Large arrays get MSD radix passes over the prefixes before multikey quicksort; needs up to
+ * 32 bytes of scratch memory per string
+ *
+ * @param strs 字符串指针数组，原地排序 / Array of string pointers, sorted in place
+ * @param count 个数 / Count
+ * @return 成功返回true，内存不足返回false（数组不变）/ true on success, false when out of memory (array unchanged)
+ */
+bool str_sort(const char **strs, size_t count);
+
+/**
+ * 忽略ASCII大小写排序 / Sort ignoring ASCII case
+ *
+ * 先为每个字符串生成一次转为小写的排序键，再按键排序，比较时不再逐字符转换；
+ * 只有大小写不同的字符串之间顺序不确定
+ * Builds a lowercased sort key once per string, then sorts by key, so no comparison folds
+ * characters again; strings differing only in case come out in unspecified order
+ *
+ * @param strs 字符串指针数组，原地排序 / Array of string pointers, sorted in place
+ * @param count 个数 / Count
+ * @return 成功返回true，内存不足返回false（数组不变）/ true on success, false when out of memory (array unchanged)
+ */
+bool str_sort_icase(const char **strs, size_t count);
+
+#endif // STR_SORT_H
@@ -8,6 +8,16 @@
 #include "string_utils.h"
 #include <string.h>   // 用于 strlen, strcpy / For strlen, strcpy
 #include <ctype.h>    // 用于 isspace, toupper, tolower / For isspace, toupper, tolower
+#include "hash.h"     // 用于 hash64_nocase / For hash64_nocase
+
+#if defined(__SSE2__)
+#include <emmintrin.h>  // SSE2
+#endif
+
+// 空白字符表 / Whitespace table
+const unsigned char str_space_table[256] = {
+    [' '] = 1, ['\t'] = 1, ['\n'] = 1, ['\v'] = 1, ['\f'] = 1, ['\r'] = 1,
+};
 
 // 去除字符串首尾空白字符 / Trim leading and trailing whitespace
 char* str_trim(const char *str, char *result, size_t result_size) {
@@ -166,3 +176,207 @@ bool str_is_alpha(const char *str) {
     }
     return true;
 }
+
+// =====================================================================
+// 忽略大小写 / Case-Insensitive
+// =====================================================================
+// tolower每次调用都要查区域设置表；这里只折叠ASCII的'A'-'Z'，一次处理16字节
+// tolower consults the locale table on every call; here only ASCII 'A'-'Z' is folded, 16 bytes at a time
+
+static inline unsigned char fold_byte(unsigned char c) {
+    return (unsigned char)(c - 'A') < 26 ? (unsigned char)(c | 0x20) : c;
+}
+
+#if defined(__SSE2__)
+// 16字节转小写：c - 'A' 作为无符号数 <= 25 即为大写字母
+// Lowercase 16 bytes: c - 'A' as unsigned <= 25 means an uppercase letter
+static inline __m128i fold16(__m128i v) {
+    __m128i t = _mm_sub_epi8(v, _mm_set1_epi8('A'));
+    __m128i is_upper = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(25)), t);
+    return _mm_or_si128(v, _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+}
+
+// 折叠后相等的字节位掩码 / Bitmask of bytes equal after folding
+static inline unsigned fold_eq_mask(__m128i a, __m128i b) {
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(fold16(a), fold16(b)));
+}
+
+// 读取8..16字节：首尾两次8字节读取（可能重叠）拼成一个寄存器
+// Load 8..16 bytes: two possibly overlapping 8-byte loads combined into one register
+static inline __m128i load_8_16(const char *p, size_t n) {
+    __m128i lo = _mm_loadl_epi64((const __m128i *)p);
+    __m128i hi = _mm_loadl_epi64((const __m128i *)(p + n - 8));
+    return _mm_unpacklo_epi64(lo, hi);
+}
+
+// 读取4..8字节，方法同上；其余字节为0 / Load 4..8 bytes the same way; other bytes are 0
+static inline __m128i load_4_8(const char *p, size_t n) {
+    int lo, hi;
+    memcpy(&lo, p, sizeof(lo));
+    memcpy(&hi, p + n - 4, sizeof(hi));
+    return _mm_unpacklo_epi32(_mm_cvtsi32_si128(lo), _mm_cvtsi32_si128(hi));
+}
+#endif
+
+// 忽略ASCII大小写比较n个字节是否相等 / Compare n bytes for equality ignoring ASCII case
+bool str_ieq_n(const char *a, const char *b, size_t n) {
+    if (a == NULL || b == NULL) {
+        return a == b || n == 0;
+    }
+
+#if defined(__SSE2__)
+    if (n >= 16) {
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+            __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+            if (fold_eq_mask(va, vb) != 0xFFFF) {
+                return false;
+            }
+        }
+        if (i < n) {
+            // 最后一块与前面重叠，避免逐字节处理尾部 / The last block overlaps, avoiding a byte-wise tail
+            __m128i va = _mm_loadu_si128((const __m128i *)(a + n - 16));
+            __m128i vb = _mm_loadu_si128((const __m128i *)(b + n - 16));
+            return fold_eq_mask(va, vb) == 0xFFFF;
+        }
+        return true;
+    }
+    if (n >= 8) {
+        return fold_eq_mask(load_8_16(a, n), load_8_16(b, n)) == 0xFFFF;
+    }
+    if (n >= 4) {
+        return fold_eq_mask(load_4_8(a, n), load_4_8(b, n)) == 0xFFFF;
+    }
+#endif
+
+    for (size_t i = 0; i < n; i++) {
+        if (fold_byte((unsigned char)a[i]) != fold_byte((unsigned char)b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 忽略ASCII大小写比较n个字节的大小 / Order n bytes ignoring ASCII case
+int str_icmp_n(const char *a, const char *b, size_t n) {
+    if (a == NULL || b == NULL) {
+        return (a != NULL) - (b != NULL);
+    }
+
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+        unsigned diff = ~fold_eq_mask(va, vb) & 0xFFFF;
+        if (diff != 0) {
+            i += (size_t)__builtin_ctz(diff);
+            return (int)fold_byte((unsigned char)a[i]) - (int)fold_byte((unsigned char)b[i]);
+        }
+    }
+#endif
+
+    for (; i < n; i++) {
+        int ca = fold_byte((unsigned char)a[i]);
+        int cb = fold_byte((unsigned char)b[i]);
+        if (ca != cb) {
+            return ca - cb;
+        }
+    }
+    return 0;
+}
+
+// 忽略ASCII大小写的字符串哈希 / String hash ignoring ASCII case
+uint64_t str_ihash(const char *str, size_t len) {
+    if (str == NULL) {
+        return 0;
+    }
+    return hash64_nocase(str, len, HASH_DEFAULT_SEED);
+}
+
+// =====================================================================
+// 内存区域版本 / Arena Variants
+// =====================================================================
+
+// 从'\0'结尾的字符串创建视图 / Make a view of a '\0'-terminated string
+str_view_t str_view(const char *str) {
+    str_view_t view = { str, str != NULL ? strlen(str) : 0 };
+    return view;
+}
+
+// 分配len + 1字节的结果 / Allocate a result of len + 1 bytes
+static char* alloc_result(arena_t *arena, str_view_t str) {
+    if (arena == NULL || (str.data == NULL && str.len != 0) || str.len == SIZE_MAX) {
+        return NULL;
+    }
+    return arena_alloc(arena, str.len + 1, 1);
+}
+
+// ASCII大小写转换：first是要转换的范围起点（'a'转大写，'A'转小写），命中的字节翻转0x20
+// ASCII case conversion: first starts the range to convert ('a' to uppercase, 'A' to lowercase);
+// matching bytes flip 0x20
+static void convert_case(char *dst, const char *src, size_t len, char first) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i base = _mm_set1_epi8(first);
+    const __m128i span = _mm_set1_epi8(25);
+    const __m128i bit = _mm_set1_epi8(0x20);
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i t = _mm_sub_epi8(v, base);
+        __m128i in_range = _mm_cmpeq_epi8(_mm_min_epu8(t, span), t);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_xor_si128(v, _mm_and_si128(in_range, bit)));
+    }
+#endif
+    for (; i < len; i++) {
+        unsigned char c = (unsigned char)src[i];
+        dst[i] = (char)((unsigned char)(c - (unsigned char)first) < 26 ? c ^ 0x20 : c);
+    }
+    dst[len] = '\0';
+}
+
+// 去除首尾空白（内存区域版本）/ Trim whitespace (arena variant)
+char* str_trim_a(arena_t *arena, str_view_t str) {
+    if (arena == NULL || (str.data == NULL && str.len != 0)) {
+        return NULL;
+    }
+    size_t start = 0, end = str.len;
+    while (start < end && isspace((unsigned char)str.data[start])) {
+        start++;
+    }
+    while (end > start && isspace((unsigned char)str.data[end - 1])) {
+        end--;
+    }
+    return arena_strndup(arena, str.data != NULL ? str.data + start : "", end - start);
+}
+
+// 转为大写（内存区域版本）/ Uppercase (arena variant)
+char* str_to_upper_a(arena_t *arena, str_view_t str) {
+    char *result = alloc_result(arena, str);
+    if (result != NULL) {
+        convert_case(result, str.data, str.len, 'a');
+    }
+    return result;
+}
+
+// 转为小写（内存区域版本）/ Lowercase (arena variant)
+char* str_to_lower_a(arena_t *arena, str_view_t str) {
+    char *result = alloc_result(arena, str);
+    if (result != NULL) {
+        convert_case(result, str.data, str.len, 'A');
+    }
+    return result;
+}
+
+// 反转字符串（内存区域版本）/ Reverse string (arena variant)
+char* str_reverse_a(arena_t *arena, str_view_t str) {
+    char *result = alloc_result(arena, str);
+    if (result != NULL) {
+        for (size_t i = 0; i < str.len; i++) {
+            result[i] = str.data[str.len - 1 - i];
+        }
+        result[str.len] = '\0';
+    }
+    return result;
+}
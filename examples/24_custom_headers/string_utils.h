@@ -10,6 +10,8 @@
 
 #include <stddef.h>   // 用于 size_t / For size_t
 #include <stdbool.h>  // 用于 bool / For bool
+#include <stdint.h>   // 用于 uint64_t / For uint64_t
+#include "arena.h"    // 用于 arena_t / For arena_t
 
 // =====================================================================
 // 宏定义 / Macro Definitions
@@ -18,6 +20,26 @@
 // 默认缓冲区大小 / Default buffer size
 #define STR_BUFFER_SIZE 256
 
+// 字节是否为空白：与"C"区域设置下的isspace相同（空格、\t、\n、\v、\f、\r），查表实现，适合热循环；
+// word_freq和inv_index都用它切分单词
+// Whether a byte is whitespace, as isspace in the "C" locale (space, \t, \n, \v, \f, \r); a table lookup
+// cheap enough for hot loops, used by word_freq and inv_index to split words
+#define STR_IS_SPACE(c) (str_space_table[(unsigned char)(c)])
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 字符串视图：指针加长度，不要求'\0'结尾，也不拥有内存
+// String view: pointer plus length; need not be '\0'-terminated and owns no memory
+typedef struct {
+    const char *data;
+    size_t len;
+} str_view_t;
+
+// STR_IS_SPACE使用的空白字符表 / Whitespace table behind STR_IS_SPACE
+extern const unsigned char str_space_table[256];
+
 // =====================================================================
 // 函数声明 / Function Declarations
 // =====================================================================
@@ -96,4 +118,89 @@ bool str_is_numeric(const char *str);
  */
 bool str_is_alpha(const char *str);
 
+/**
+ * 忽略ASCII大小写比较n个字节是否相等 / Compare n bytes for equality ignoring ASCII case
+ *
+ * 只折叠'A'-'Z'，与区域设置无关；不检查'\0'，n个字节都必须可读
+ * Folds only 'A'-'Z', independent of locale; does not stop at '\0', all n bytes must be readable
+ *
+ * @param a 第一个字符串 / First string
+ * @param b 第二个字符串 / Second string
+ * @param n 比较的字节数 / Number of bytes to compare
+ * @return true如果相等 / true if equal
+ */
+bool str_ieq_n(const char *a, const char *b, size_t n);
+
+/**
+ * 忽略ASCII大小写比较n个字节的大小 / Order n bytes ignoring ASCII case
+ *
+ * 与memcmp相同，但先把'A'-'Z'转为小写；不检查'\0'
+ * Like memcmp after lowercasing 'A'-'Z'; does not stop at '\0'
+ *
+ * @param a 第一个字符串 / First string
+ * @param b 第二个字符串 / Second string
+ * @param n 比较的字节数 / Number of bytes to compare
+ * @return 小于、等于或大于0 / Less than, equal to, or greater than 0
+ */
+int str_icmp_n(const char *a, const char *b, size_t n);
+
+/**
+ * 忽略ASCII大小写的字符串哈希 / String hash ignoring ASCII case
+ *
+ * 大小写不同的字符串得到相同的值，适合不区分大小写的哈希表；等于hash64_nocase(str, len, 0)
+ * Strings differing only in case hash equal, for case-insensitive hash tables; equals hash64_nocase(str, len, 0)
+ *
+ * @param str 字符串 / String
+ * @param len 字符串长度 / String length
+ * @return 64位哈希值 / 64-bit hash value
+ */
+uint64_t str_ihash(const char *str, size_t len);
+
+// =====================================================================
+// 内存区域版本 / Arena Variants
+// =====================================================================
+// 结果从调用者的内存区域分配，长度不受STR_BUFFER_SIZE限制，不会截断；
+// 一次arena_reset释放全部结果。分配失败返回NULL。
+// Results are allocated from the caller's arena, with no STR_BUFFER_SIZE cap and no truncation;
+// one arena_reset releases them all. Return NULL if allocation fails.
+
+/**
+ * 从'\0'结尾的字符串创建视图 / Make a view of a '\0'-terminated string
+ * @param str 字符串，可以为NULL / String, may be NULL
+ * @return 视图（NULL得到空视图）/ The view (NULL gives an empty view)
+ */
+str_view_t str_view(const char *str);
+
+/**
+ * 去除首尾空白（内存区域版本）/ Trim whitespace (arena variant)
+ * @param arena 内存区域 / Arena
+ * @param str 原字符串 / Original string
+ * @return 以'\0'结尾的结果 / '\0'-terminated result
+ */
+char* str_trim_a(arena_t *arena, str_view_t str);
+
+/**
+ * 转为大写（内存区域版本，只转换ASCII字母）/ Uppercase (arena variant, ASCII letters only)
+ * @param arena 内存区域 / Arena
+ * @param str 原字符串 / Original string
+ * @return 以'\0'结尾的结果 / '\0'-terminated result
+ */
+char* str_to_upper_a(arena_t *arena, str_view_t str);
+
+/**
+ * 转为小写（内存区域版本，只转换ASCII字母）/ Lowercase (arena variant, ASCII letters only)
+ * @param arena 内存区域 / Arena
+ * @param str 原字符串 / Original string
+ * @return 以'\0'结尾的结果 / '\0'-terminated result
+ */
+char* str_to_lower_a(arena_t *arena, str_view_t str);
+
+/**
+ * 反转字符串（内存区域版本）/ Reverse string (arena variant)
+ * @param arena 内存区域 / Arena
+ * @param str 原字符串 / Original string
+ * @return 以'\0'结尾的结果 / '\0'-terminated result
+ */
+char* str_reverse_a(arena_t *arena, str_view_t str);
+
 #endif // STRING_UTILS_H
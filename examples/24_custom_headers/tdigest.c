@@ -0,0 +1,302 @@
+/**
+ * t-digest分位数草图实现文件 / t-digest Quantile Sketch Implementation
+ *
+ * 合并式t-digest：新值先进缓冲区，缓冲区满时排序，与已有质心按均值归并，再从左到右扫描，
+ * 只要合并后的质心在刻度函数k(q) = δ/Z·ln(q/(1-q))上跨度不超过1就并进当前质心，Z = 4·ln(n/δ) + 24。
+ * k在q接近0和1时变化最快，两端的质心权重与q（或1-q）成正比，最外面的是单个值
+ * Merging t-digest: new values go into a buffer; when it fills up it is sorted, merged by mean with the
+ * existing centroids and scanned left to right, folding each item into the current centroid as long as the
+ * result spans at most 1 on the scale function k(q) = δ/Z·ln(q/(1-q)), where Z = 4·ln(n/δ) + 24. k changes
+ * fastest near q = 0 and q = 1, so centroid weights at both ends are proportional to q (or 1-q) and the
+ * outermost ones are single values
+ */
+
+#include "tdigest.h"
+#include <math.h>     // 用于 exp, log, ceil, NAN / For exp, log, ceil, NAN
+#include <stdlib.h>   // 用于 malloc, free / For malloc, free
+#include <stdint.h>   // 用于 uint32_t, uint64_t / For uint32_t, uint64_t
+#include <string.h>   // 用于 memcpy, memset / For memcpy, memset
+
+// 缓冲区是质心数上限的几倍 / Buffer size as a multiple of the centroid capacity
+#define TDIGEST_BUFFER_FACTOR 5
+
+// =====================================================================
+// 排序 / Sorting
+// =====================================================================
+
+// 把double的位模式变成按数值顺序排列的无符号整数：正数翻转符号位，负数翻转全部位
+// Map a double's bit pattern to an unsigned integer in numeric order: flip the sign bit of positives
+// and every bit of negatives
+static uint64_t sort_key(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits ^ ((uint64_t)((int64_t)bits >> 63) | 0x8000000000000000ull);
+}
+
+// 按均值做LSD基数排序，每次8位；所有键在某个字节上都相同时跳过这一趟（数量级相近时高位字节大多如此）
+// LSD radix sort by mean, 8 bits per pass; a pass is skipped when every key has the same byte there
+// (usually the case for the high bytes when values have similar magnitudes)
+static void sort_centroids(tdigest_centroid_t *items, tdigest_centroid_t *temp, size_t n) {
+    uint32_t counts[8][256];
+    memset(counts, 0, sizeof(counts));
+    for (size_t i = 0; i < n; i++) {
+        uint64_t key = sort_key(items[i].mean);
+        for (int d = 0; d < 8; d++) {
+            counts[d][(key >> (8 * d)) & 0xFF]++;
+        }
+    }
+    tdigest_centroid_t *src = items, *dst = temp;
+    uint64_t first = n > 0 ? sort_key(items[0].mean) : 0;
+    for (int d = 0; d < 8; d++) {
+        if (counts[d][(first >> (8 * d)) & 0xFF] == n) {
+            continue;
+        }
+        uint32_t offsets[256];
+        uint32_t sum = 0;
+        for (int b = 0; b < 256; b++) {
+            offsets[b] = sum;
+            sum += counts[d][b];
+        }
+        for (size_t i = 0; i < n; i++) {
+            dst[offsets[(sort_key(src[i].mean) >> (8 * d)) & 0xFF]++] = src[i];
+        }
+        tdigest_centroid_t *t = src;
+        src = dst;
+        dst = t;
+    }
+    if (src != items) {
+        memcpy(items, src, n * sizeof(tdigest_centroid_t));
+    }
+}
+
+// =====================================================================
+// 合并 / Merging
+// =====================================================================
+
+// 从分位点q0开始的质心最多能延伸到的分位点：解k(q) = k(q0) + 1得q = q0 / (q0 + (1 - q0)·e^(-Z/δ))
+// The furthest quantile a centroid starting at q0 may reach: solving k(q) = k(q0) + 1 gives
+// q = q0 / (q0 + (1 - q0)·e^(-Z/δ))
+static double quantile_limit(double q0, double shrink) {
+    return q0 / (q0 + (1.0 - q0) * shrink);
+}
+
+// 把缓冲区排序后与质心归并，再按刻度函数重新聚类 / Sort the buffer, merge it with the centroids and recluster
+static void compress(tdigest_t *digest) {
+    if (digest->buffered == 0) {
+        return;
+    }
+    sort_centroids(digest->buffer, digest->scratch, digest->buffered);
+
+    // 两个有序序列归并到scratch / Merge the two sorted runs into scratch
+    tdigest_centroid_t *merged = digest->scratch;
+    size_t a = 0, b = 0, n = 0;
+    while (a < digest->num_centroids && b < digest->buffered) {
+        if (digest->centroids[a].mean <= digest->buffer[b].mean) {
+            merged[n++] = digest->centroids[a++];
+        } else {
+            merged[n++] = digest->buffer[b++];
+        }
+    }
+    while (a < digest->num_centroids) {
+        merged[n++] = digest->centroids[a++];
+    }
+    while (b < digest->buffered) {
+        merged[n++] = digest->buffer[b++];
+    }
+    digest->buffered = 0;
+
+    // 从左到右聚类；达到上限时强制合并，保证不越界
+    // Cluster left to right; at the capacity, merging is forced so the array never overflows
+    double total = digest->total_weight;
+    double normalizer = 4.0 * log(total > digest->compression ? total / digest->compression : 1.0) + 24.0;
+    double shrink = exp(-normalizer / digest->compression);     // e^(-Z/δ)
+    double weight_before = 0.0;     // 当前质心之前的总权重 / Total weight before the current centroid
+    double weight_limit = 0.0;      // 当前质心结束处累积权重的上限 / Limit on the cumulative weight where the current centroid ends
+    double weight = merged[0].weight;
+    double weighted_sum = merged[0].mean * merged[0].weight;    // Σ均值·权重 / Σ mean·weight
+    size_t count = 0;
+    for (size_t i = 1; i < n; i++) {
+        if (weight_before + weight + merged[i].weight <= weight_limit ||
+            count + 1 >= digest->centroid_capacity) {
+            weight += merged[i].weight;
+            weighted_sum += merged[i].mean * merged[i].weight;
+        } else {
+            digest->centroids[count].mean = weighted_sum / weight;
+            digest->centroids[count].weight = weight;
+            count++;
+            weight_before += weight;
+            weight_limit = quantile_limit(weight_before / total, shrink) * total;
+            weight = merged[i].weight;
+            weighted_sum = merged[i].mean * merged[i].weight;
+        }
+    }
+    digest->centroids[count].mean = weighted_sum / weight;
+    digest->centroids[count].weight = weight;
+    digest->num_centroids = count + 1;
+}
+
+// 加入一个带权重的点 / Add one weighted point
+static void push(tdigest_t *digest, double mean, double weight) {
+    if (digest->buffered == digest->buffer_capacity) {
+        compress(digest);
+    }
+    digest->buffer[digest->buffered].mean = mean;
+    digest->buffer[digest->buffered].weight = weight;
+    digest->buffered++;
+    digest->total_weight += weight;
+    digest->min = mean < digest->min ? mean : digest->min;
+    digest->max = mean > digest->max ? mean : digest->max;
+}
+
+// =====================================================================
+// 公共接口 / Public Interface
+// =====================================================================
+
+bool tdigest_init(tdigest_t *digest, double compression) {
+    memset(digest, 0, sizeof(*digest));
+    if (!(compression >= 10.0 && compression <= 1e6)) {
+        return false;
+    }
+    // 相邻两个质心在k上合计跨度超过1，而k在[1/n, 1 - 1/n]上的跨度小于δ/2，所以质心数不超过δ + 2
+    // Two adjacent centroids together span more than 1 on k and k spans less than δ/2 over [1/n, 1 - 1/n],
+    // so there are at most δ + 2 centroids
+    digest->centroid_capacity = (size_t)ceil(compression) + 8;
+    digest->buffer_capacity = digest->centroid_capacity * TDIGEST_BUFFER_FACTOR;
+    digest->centroids = malloc(digest->centroid_capacity * sizeof(tdigest_centroid_t));
+    digest->buffer = malloc(digest->buffer_capacity * sizeof(tdigest_centroid_t));
+    digest->scratch = malloc((digest->centroid_capacity + digest->buffer_capacity) * sizeof(tdigest_centroid_t));
+    if (digest->centroids == NULL || digest->buffer == NULL || digest->scratch == NULL) {
+        tdigest_free(digest);
+        return false;
+    }
+    digest->compression = compression;
+    digest->min = INFINITY;
+    digest->max = -INFINITY;
+    return true;
+}
+
+void tdigest_free(tdigest_t *digest) {
+    free(digest->centroids);
+    free(digest->buffer);
+    free(digest->scratch);
+    memset(digest, 0, sizeof(*digest));
+}
+
+void tdigest_add(tdigest_t *digest, double value) {
+    if (!isnan(value)) {
+        push(digest, value, 1.0);
+    }
+}
+
+void tdigest_add_array(tdigest_t *digest, const double *values, size_t count) {
+    double min = digest->min, max = digest->max;
+    size_t i = 0;
+    while (i < count) {
+        if (digest->buffered == digest->buffer_capacity) {
+            digest->min = min;
+            digest->max = max;
+            compress(digest);
+        }
+        // 一次填满缓冲区的剩余部分 / Fill the rest of the buffer in one run
+        size_t run = digest->buffer_capacity - digest->buffered;
+        if (run > count - i) {
+            run = count - i;
+        }
+        tdigest_centroid_t *out = digest->buffer + digest->buffered;
+        size_t added = 0;
+        for (size_t j = i; j < i + run; j++) {
+            double v = values[j];
+            if (isnan(v)) {
+                continue;
+            }
+            out[added].mean = v;
+            out[added].weight = 1.0;
+            added++;
+            min = v < min ? v : min;
+            max = v > max ? v : max;
+        }
+        digest->buffered += added;
+        digest->total_weight += (double)added;
+        i += run;
+    }
+    digest->min = min;
+    digest->max = max;
+}
+
+void tdigest_merge(tdigest_t *digest, const tdigest_t *other) {
+    for (size_t i = 0; i < other->num_centroids; i++) {
+        push(digest, other->centroids[i].mean, other->centroids[i].weight);
+    }
+    for (size_t i = 0; i < other->buffered; i++) {
+        push(digest, other->buffer[i].mean, other->buffer[i].weight);
+    }
+    // 质心的均值不一定是最值，单独合并 / A centroid mean is not necessarily an extreme, so merge those separately
+    digest->min = other->min < digest->min ? other->min : digest->min;
+    digest->max = other->max > digest->max ? other->max : digest->max;
+}
+
+// 每个质心的权重看作以其均值为中心均匀分布，两端分别插值到精确的最小值和最大值
+// Each centroid's weight is treated as spread evenly around its mean, with the two ends interpolated to
+// the exact minimum and maximum
+double tdigest_quantile(tdigest_t *digest, double q) {
+    compress(digest);
+    if (digest->num_centroids == 0) {
+        return NAN;
+    }
+    if (q <= 0.0) {
+        return digest->min;
+    }
+    if (q >= 1.0) {
+        return digest->max;
+    }
+    const tdigest_centroid_t *c = digest->centroids;
+    size_t n = digest->num_centroids;
+    double index = q * digest->total_weight;
+
+    // 第一个质心中心之前 / Before the center of the first centroid
+    if (index < c[0].weight / 2.0) {
+        return digest->min + (c[0].mean - digest->min) * index / (c[0].weight / 2.0);
+    }
+    double center = c[0].weight / 2.0;  // 当前质心中心处的累积权重 / Cumulative weight at the current centroid's center
+    for (size_t i = 0; i + 1 < n; i++) {
+        double gap = (c[i].weight + c[i + 1].weight) / 2.0;
+        if (index < center + gap) {
+            return c[i].mean + (c[i + 1].mean - c[i].mean) * (index - center) / gap;
+        }
+        center += gap;
+    }
+    // 最后一个质心中心之后 / After the center of the last centroid
+    double half = c[n - 1].weight / 2.0;
+    double t = (index - center) / half;
+    return c[n - 1].mean + (digest->max - c[n - 1].mean) * (t < 1.0 ? t : 1.0);
+}
+
+double tdigest_cdf(tdigest_t *digest, double value) {
+    compress(digest);
+    if (digest->num_centroids == 0) {
+        return NAN;
+    }
+    if (value < digest->min) {
+        return 0.0;
+    }
+    if (value >= digest->max) {
+        return 1.0;
+    }
+    const tdigest_centroid_t *c = digest->centroids;
+    size_t n = digest->num_centroids;
+    double total = digest->total_weight;
+
+    if (value < c[0].mean) {
+        return (value - digest->min) / (c[0].mean - digest->min) * (c[0].weight / 2.0) / total;
+    }
+    double center = c[0].weight / 2.0;
+    for (size_t i = 0; i + 1 < n; i++) {
+        double gap = (c[i].weight + c[i + 1].weight) / 2.0;
+        if (value < c[i + 1].mean) {
+            return (center + gap * (value - c[i].mean) / (c[i + 1].mean - c[i].mean)) / total;
+        }
+        center += gap;
+    }
+    double half = c[n - 1].weight / 2.0;
+    return (center + half * (value - c[n - 1].mean) / (digest->max - c[n - 1].mean)) / total;
+}
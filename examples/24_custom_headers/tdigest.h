@@ -0,0 +1,124 @@
+/**
+ * t-digest分位数草图头文件 / t-digest Quantile Sketch Header
+ *
+ * 用固定大小的内存近似任意多个值的分布，查询p50/p99/p999等分位数时不需要保存和排序全部数据。
+ * 数据聚成若干个质心（均值+权重），分布两端的质心很小，中间的很大，所以尾部分位数的误差远小于中位数附近；
+ * 两个草图可以合并，每个线程或每个数据分片各建一个，最后合并
+ * Approximates the distribution of any number of values in a fixed amount of memory, so quantiles such as
+ * p50/p99/p999 can be queried without keeping or sorting all the data. Values are clustered into centroids
+ * (mean + weight) that are tiny at both ends of the distribution and large in the middle, which makes tail
+ * quantiles far more accurate than those near the median; two sketches can be merged, so every thread or
+ * data shard can build its own and merge at the end
+ *
+ * 参考 / Reference: Dunning & Ertl, "Computing Extremely Accurate Quantiles Using t-Digests", 2019.
+ */
+
+#ifndef TDIGEST_H
+#define TDIGEST_H
+
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stddef.h>   // 用于 size_t / For size_t
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 默认压缩参数：质心数约为它的一半到一倍 / Default compression: there are about half to one times as many centroids
+#define TDIGEST_DEFAULT_COMPRESSION 200
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 质心 / Centroid
+typedef struct {
+    double mean;            // 聚在一起的值的均值 / Mean of the clustered values
+    double weight;          // 值的个数 / Number of values
+} tdigest_centroid_t;
+
+// t-digest草图 / t-digest sketch
+typedef struct {
+    double compression;             // 压缩参数δ / Compression parameter δ
+    tdigest_centroid_t *centroids;  // 按均值排序的质心 / Centroids sorted by mean
+    size_t num_centroids;           // 质心数 / Number of centroids
+    size_t centroid_capacity;       // 质心数上限 / Maximum number of centroids
+    tdigest_centroid_t *buffer;     // 尚未合并的新值 / New values not merged yet
+    size_t buffered;                // 缓冲的个数 / Number buffered
+    size_t buffer_capacity;         // 缓冲区大小 / Buffer size
+    tdigest_centroid_t *scratch;    // 排序和合并用的临时空间 / Scratch space for sorting and merging
+    double total_weight;            // 值的总数（含缓冲）/ Total number of values (including buffered ones)
+    double min;                     // 精确的最小值 / Exact minimum
+    double max;                     // 精确的最大值 / Exact maximum
+} tdigest_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 初始化草图并一次分配好全部内存 / Initialize a sketch, allocating all of its memory up front
+ * @param digest 草图 / Sketch
+ * @param compression 压缩参数δ（10..1e6），越大越准、占用越多；通常用TDIGEST_DEFAULT_COMPRESSION
+ *                    Compression δ (10..1e6), larger is more accurate and uses more memory; usually
+ *                    TDIGEST_DEFAULT_COMPRESSION
+ * @return 成功返回true，参数无效或内存不足返回false / true on success, false for bad parameters or out of memory
+ */
+bool tdigest_init(tdigest_t *digest, double compression);
+
+/**
+ * 释放草图 / Free a sketch
+ * @param digest 草图 / Sketch
+ */
+void tdigest_free(tdigest_t *digest);
+
+/**
+ * 加入一个值；NaN被忽略 / Add one value; NaN is ignored
+ * @param digest 草图 / Sketch
+ * @param value 值 / Value
+ */
+void tdigest_add(tdigest_t *digest, double value);
+
+/**
+ * 批量加入：与逐个调用tdigest_add结果相同，只是方便调用
+ * Add a batch: a convenience wrapper with the same result as calling tdigest_add for each value
+ *
+ * 耗时主要在缓冲区满时的排序与合并，两种方式做的一样多，所以批量加入并不更快
+ * Most of the time goes into sorting and merging each full buffer, which both ways do equally, so a batch
+ * is not faster
+ *
+ * @param digest 草图 / Sketch
+ * @param values 值数组，NaN被忽略 / Values, NaN is ignored
+ * @param count 个数 / Number of values
+ */
+void tdigest_add_array(tdigest_t *digest, const double *values, size_t count);
+
+/**
+ * 把other合并进digest（other不变）/ Merge other into digest (other is unchanged)
+ * @param digest 草图 / Sketch
+ * @param other 要合并的草图，不能是digest本身 / Sketch to merge, must not be digest itself
+ */
+void tdigest_merge(tdigest_t *digest, const tdigest_t *other);
+
+/**
+ * 估计分位数 / Estimate a quantile
+ *
+ * 查询前先合并缓冲区，所以需要非const指针 / Merges the buffer first, hence the non-const pointer
+ *
+ * @param digest 草图 / Sketch
+ * @param q 分位点，0到1（0.99表示p99）/ Quantile, 0 to 1 (0.99 for p99)
+ * @return 估计值；q <= 0返回最小值，q >= 1返回最大值，草图为空返回NaN
+ *         Estimate; the minimum for q <= 0, the maximum for q >= 1, NaN for an empty sketch
+ */
+double tdigest_quantile(tdigest_t *digest, double q);
+
+/**
+ * 估计不超过value的值所占的比例（累积分布函数）
+ * Estimate the fraction of values at or below value (cumulative distribution function)
+ *
+ * @param digest 草图 / Sketch
+ * @param value 值 / Value
+ * @return 0到1之间的比例，草图为空返回NaN / Fraction between 0 and 1, NaN for an empty sketch
+ */
+double tdigest_cdf(tdigest_t *digest, double value);
+
+#endif // TDIGEST_H
@@ -5,9 +5,24 @@
  * Implementation of functions declared in header file
  */
 
+// sysconf需要POSIX声明 / sysconf needs the POSIX declarations
+#define _POSIX_C_SOURCE 200809L
+
 #include "utils.h"      // 包含对应的头文件 / Include corresponding header
-#include <string.h>     // 用于 strlen / For strlen
+#include <string.h>     // 用于 strlen, memcpy, memmove / For strlen, memcpy, memmove
 #include <stdio.h>      // 用于 snprintf / For snprintf
+#include <stdint.h>     // 用于 uintptr_t / For uintptr_t
+#include <stdlib.h>     // 用于 getenv, strtol / For getenv, strtol
+#include <limits.h>     // 用于 INT_MAX, INT_MIN / For INT_MAX, INT_MIN
+#include <pthread.h>    // 用于 pthread_create, pthread_join / For pthread_create, pthread_join
+
+#if !defined(_WIN32) && !defined(_WIN64)
+    #include <unistd.h>     // 用于 sysconf / For sysconf
+#endif
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>  // 用于 SSE2 / For SSE2
+#endif
 
 // =====================================================================
 // 静态变量 / Static Variables
@@ -17,6 +32,56 @@
 
 static char version_string[32] = {0};
 
+// 每个线程最近一次失败的上下文，只在失败时写入 / Context of each thread's latest failure, written only on failure
+static _Thread_local utils_error_t last_error;
+
+// 按需格式化的错误消息 / Error message, formatted on demand
+static _Thread_local char last_error_message[160];
+
+// =====================================================================
+// 内部函数 / Internal Functions
+// =====================================================================
+
+// 记录失败并返回状态码；只在错误路径上调用，标为cold让编译器把它移出热路径
+// Record a failure and return its status; only called on error paths, and marked cold so the compiler
+// moves it off the hot path
+#if defined(__GNUC__)
+__attribute__((cold, noinline))
+#endif
+static utils_status_t record_error(utils_status_t status, const char *function, size_t size, size_t argument) {
+    last_error.status = status;
+    last_error.function = function;
+    last_error.size = size;
+    last_error.argument = argument;
+    return status;
+}
+
+// 失败时的紧凑返回值 / Compact return value for a failure
+static utils_value_t value_error(utils_status_t status, const char *function, size_t size, size_t argument) {
+    utils_value_t result = { 0, record_error(status, function, size, argument) };
+    return result;
+}
+
+static int max_of(const int *arr, size_t size) {
+    int max = arr[0];
+    for (size_t i = 1; i < size; i++) {
+        if (arr[i] > max) {
+            max = arr[i];
+        }
+    }
+    return max;
+}
+
+static int min_of(const int *arr, size_t size) {
+    int min = arr[0];
+    for (size_t i = 1; i < size; i++) {
+        if (arr[i] < min) {
+            min = arr[i];
+        }
+    }
+    return min;
+}
+
 // =====================================================================
 // 函数实现 / Function Implementations
 // =====================================================================
@@ -55,52 +120,700 @@ double utils_array_average(const int *arr, size_t size) {
 // 查找数组中的最大值 / Find maximum value in array
 utils_status_t utils_array_max(const int *arr, size_t size, int *result) {
     if (arr == NULL || result == NULL) {
-        return UTILS_ERROR_NULL;
+        return record_error(UTILS_ERROR_NULL, __func__, size, 0);
     }
     if (size == 0) {
-        return UTILS_ERROR_RANGE;
+        return record_error(UTILS_ERROR_RANGE, __func__, size, 0);
     }
     
-    int max = arr[0];
-    for (size_t i = 1; i < size; i++) {
-        if (arr[i] > max) {
-            max = arr[i];
-        }
-    }
-    *result = max;
+    *result = max_of(arr, size);
     return UTILS_SUCCESS;
 }
 
 // 查找数组中的最小值 / Find minimum value in array
 utils_status_t utils_array_min(const int *arr, size_t size, int *result) {
     if (arr == NULL || result == NULL) {
-        return UTILS_ERROR_NULL;
+        return record_error(UTILS_ERROR_NULL, __func__, size, 0);
     }
     if (size == 0) {
-        return UTILS_ERROR_RANGE;
+        return record_error(UTILS_ERROR_RANGE, __func__, size, 0);
     }
     
-    int min = arr[0];
-    for (size_t i = 1; i < size; i++) {
-        if (arr[i] < min) {
-            min = arr[i];
+    *result = min_of(arr, size);
+    return UTILS_SUCCESS;
+}
+
+// 查找最大值，值和状态码一起用寄存器返回 / Find the maximum, returning value and status together in registers
+utils_value_t utils_array_max_value(const int *arr, size_t size) {
+    if (arr == NULL) {
+        return value_error(UTILS_ERROR_NULL, __func__, size, 0);
+    }
+    if (size == 0) {
+        return value_error(UTILS_ERROR_RANGE, __func__, size, 0);
+    }
+    utils_value_t result = { max_of(arr, size), UTILS_SUCCESS };
+    return result;
+}
+
+// 查找最小值，值和状态码一起用寄存器返回 / Find the minimum, returning value and status together in registers
+utils_value_t utils_array_min_value(const int *arr, size_t size) {
+    if (arr == NULL) {
+        return value_error(UTILS_ERROR_NULL, __func__, size, 0);
+    }
+    if (size == 0) {
+        return value_error(UTILS_ERROR_RANGE, __func__, size, 0);
+    }
+    utils_value_t result = { min_of(arr, size), UTILS_SUCCESS };
+    return result;
+}
+
+// 一次遍历的数组统计 / One-pass array statistics
+//
+// 和用64位整数累加（结果精确）；平方和用double累加与arr[0]的差，
+// 数据远离0时也不会因为大数相减丢失方差的精度
+// The sum is accumulated in 64-bit integers (exact); squares are accumulated in double as differences
+// from arr[0], so the variance keeps its precision even when the data is far from 0
+utils_status_t utils_array_stats(const int *arr, size_t size, utils_stats_t *result) {
+    if (arr == NULL || result == NULL) {
+        return record_error(UTILS_ERROR_NULL, __func__, size, 0);
+    }
+    if (size == 0) {
+        return record_error(UTILS_ERROR_RANGE, __func__, size, 0);
+    }
+
+    const int shift = arr[0];
+    long long sum = 0;
+    int min = arr[0], max = arr[0];
+    double squares = 0.0;   // Σ(x - shift)²
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    // 每种量两个累加器，两组4个元素互不依赖 / Two accumulators per quantity, so the two groups of 4 are independent
+    __m128i min0 = _mm_set1_epi32(min), min1 = min0;
+    __m128i max0 = min0, max1 = min0;
+    __m128i sum0 = _mm_setzero_si128(), sum1 = sum0;    // 每个2个int64 / 2 int64 each
+    __m128d sq0 = _mm_setzero_pd(), sq1 = sq0, sq2 = sq0, sq3 = sq0;
+    const __m128d vshift = _mm_set1_pd((double)shift);
+    for (; i + 8 <= size; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(arr + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(arr + i + 4));
+
+        // SSE2没有pminsd/pmaxsd，用比较加选择 / SSE2 has no pminsd/pmaxsd, so compare and select
+        __m128i lt = _mm_cmplt_epi32(a, min0);
+        min0 = _mm_or_si128(_mm_and_si128(lt, a), _mm_andnot_si128(lt, min0));
+        lt = _mm_cmplt_epi32(b, min1);
+        min1 = _mm_or_si128(_mm_and_si128(lt, b), _mm_andnot_si128(lt, min1));
+        __m128i gt = _mm_cmpgt_epi32(a, max0);
+        max0 = _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, max0));
+        gt = _mm_cmpgt_epi32(b, max1);
+        max1 = _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, max1));
+
+        // 符号扩展到64位再相加 / Sign-extend to 64 bits before adding
+        __m128i sign_a = _mm_srai_epi32(a, 31), sign_b = _mm_srai_epi32(b, 31);
+        sum0 = _mm_add_epi64(sum0, _mm_unpacklo_epi32(a, sign_a));
+        sum1 = _mm_add_epi64(sum1, _mm_unpackhi_epi32(a, sign_a));
+        sum0 = _mm_add_epi64(sum0, _mm_unpacklo_epi32(b, sign_b));
+        sum1 = _mm_add_epi64(sum1, _mm_unpackhi_epi32(b, sign_b));
+
+        __m128d d0 = _mm_sub_pd(_mm_cvtepi32_pd(a), vshift);
+        __m128d d1 = _mm_sub_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 2, 3, 2))), vshift);
+        __m128d d2 = _mm_sub_pd(_mm_cvtepi32_pd(b), vshift);
+        __m128d d3 = _mm_sub_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(b, _MM_SHUFFLE(3, 2, 3, 2))), vshift);
+        sq0 = _mm_add_pd(sq0, _mm_mul_pd(d0, d0));
+        sq1 = _mm_add_pd(sq1, _mm_mul_pd(d1, d1));
+        sq2 = _mm_add_pd(sq2, _mm_mul_pd(d2, d2));
+        sq3 = _mm_add_pd(sq3, _mm_mul_pd(d3, d3));
+    }
+
+    int lanes[8];
+    long long sums[4];
+    double sq[2];
+    _mm_storeu_si128((__m128i *)lanes, min0);
+    _mm_storeu_si128((__m128i *)(lanes + 4), min1);
+    for (int k = 0; k < 8; k++) {
+        min = lanes[k] < min ? lanes[k] : min;
+    }
+    _mm_storeu_si128((__m128i *)lanes, max0);
+    _mm_storeu_si128((__m128i *)(lanes + 4), max1);
+    for (int k = 0; k < 8; k++) {
+        max = lanes[k] > max ? lanes[k] : max;
+    }
+    _mm_storeu_si128((__m128i *)sums, sum0);
+    _mm_storeu_si128((__m128i *)(sums + 2), sum1);
+    sum = sums[0] + sums[1] + sums[2] + sums[3];
+    _mm_storeu_pd(sq, _mm_add_pd(_mm_add_pd(sq0, sq1), _mm_add_pd(sq2, sq3)));
+    squares = sq[0] + sq[1];
+#endif
+
+    for (; i < size; i++) {
+        int x = arr[i];
+        min = x < min ? x : min;
+        max = x > max ? x : max;
+        sum += x;
+        double d = (double)x - (double)shift;
+        squares += d * d;
+    }
+
+    // Σ(x - shift)用整数算，不会抵消 / Σ(x - shift) is computed in integers, so nothing cancels
+    double n = (double)size;
+    double mean_shifted = (double)(sum - (long long)shift * (long long)size) / n;
+    double variance = squares / n - mean_shifted * mean_shifted;
+    result->sum = sum;
+    result->min = min;
+    result->max = max;
+    result->mean = (double)sum / n;
+    result->variance = variance > 0.0 ? variance : 0.0;
+    return UTILS_SUCCESS;
+}
+
+// =====================================================================
+// 流式统计 / Streaming Statistics
+// =====================================================================
+
+// 初始化累加器 / Initialize an accumulator
+void utils_accum_init(utils_accum_t *acc) {
+    if (acc == NULL) {
+        record_error(UTILS_ERROR_NULL, __func__, 0, 0);
+        return;
+    }
+    acc->count = 0;
+    acc->sum = 0;
+    acc->min = INT_MAX;
+    acc->max = INT_MIN;
+    acc->mean = 0.0;
+    acc->m2 = 0.0;
+}
+
+// Welford：每个值只更新均值和M2，不需要保留已看过的数据
+// Welford: each value only updates the mean and M2, so nothing seen so far needs to be kept
+void utils_accum_add(utils_accum_t *acc, int value) {
+    if (acc == NULL) {
+        record_error(UTILS_ERROR_NULL, __func__, 0, 0);
+        return;
+    }
+    acc->count++;
+    // 无符号相加，溢出时回绕而不是未定义行为 / Unsigned addition, so overflow wraps instead of being undefined
+    acc->sum = (long long)((unsigned long long)acc->sum + (unsigned long long)(long long)value);
+    acc->min = value < acc->min ? value : acc->min;
+    acc->max = value > acc->max ? value : acc->max;
+    double delta = (double)value - acc->mean;
+    acc->mean += delta / (double)acc->count;
+    acc->m2 += delta * ((double)value - acc->mean);
+}
+
+// Chan等人的合并公式：M2 = M2a + M2b + δ²·na·nb/n，其中δ是两个均值之差
+// Chan et al.'s combination: M2 = M2a + M2b + δ²·na·nb/n, where δ is the difference of the two means
+void utils_accum_merge(utils_accum_t *acc, const utils_accum_t *other) {
+    if (acc == NULL || other == NULL) {
+        record_error(UTILS_ERROR_NULL, __func__, 0, 0);
+        return;
+    }
+    if (other->count == 0) {
+        return;
+    }
+    if (acc->count == 0) {
+        *acc = *other;
+        return;
+    }
+    double na = (double)acc->count, nb = (double)other->count;
+    double n = na + nb;
+    double delta = other->mean - acc->mean;
+    acc->count += other->count;
+    acc->sum = (long long)((unsigned long long)acc->sum + (unsigned long long)other->sum);
+    acc->min = other->min < acc->min ? other->min : acc->min;
+    acc->max = other->max > acc->max ? other->max : acc->max;
+    acc->mean += delta * (nb / n);
+    acc->m2 += other->m2 + delta * delta * (na * nb / n);
+}
+
+// 整块交给utils_array_stats（SSE2），再把块的结果合并进来
+// The block goes through utils_array_stats (SSE2) and its result is merged in
+utils_status_t utils_accum_add_array(utils_accum_t *acc, const int *arr, size_t size) {
+    if (acc == NULL || arr == NULL) {
+        return record_error(UTILS_ERROR_NULL, __func__, size, 0);
+    }
+    utils_stats_t stats;
+    if (size == 0 || utils_array_stats(arr, size, &stats) != UTILS_SUCCESS) {
+        return UTILS_SUCCESS;
+    }
+    utils_accum_t block;
+    block.count = size;
+    block.sum = stats.sum;
+    block.min = stats.min;
+    block.max = stats.max;
+    block.mean = stats.mean;
+    block.m2 = stats.variance * (double)size;
+    utils_accum_merge(acc, &block);
+    return UTILS_SUCCESS;
+}
+
+// 总体方差 / Population variance
+double utils_accum_variance(const utils_accum_t *acc) {
+    if (acc == NULL) {
+        record_error(UTILS_ERROR_NULL, __func__, 0, 0);
+        return 0.0;
+    }
+    return acc->count == 0 ? 0.0 : acc->m2 / (double)acc->count;
+}
+
+// =====================================================================
+// 并行归约 / Parallel Reductions
+// =====================================================================
+
+// 归约的种类 / Kind of reduction
+typedef enum {
+    REDUCE_SUM,
+    REDUCE_MAX,
+    REDUCE_MIN
+} reduce_kind_t;
+
+// 一个线程的任务；对齐到缓存行，线程写各自的结果时不会互相使缓存行失效
+// One thread's job; aligned to a cache line so threads writing their results do not invalidate each other's lines
+typedef struct {
+    _Alignas(64) const int *arr;
+    size_t size;
+    reduce_kind_t kind;
+    long long sum;          // REDUCE_SUM的结果 / Result of REDUCE_SUM
+    int extreme;            // REDUCE_MAX/REDUCE_MIN的结果 / Result of REDUCE_MAX/REDUCE_MIN
+} reduce_job_t;
+
+static long long sum_range(const int *arr, size_t size) {
+    long long sum = 0;
+    for (size_t i = 0; i < size; i++) {
+        sum += arr[i];
+    }
+    return sum;
+}
+
+static void *reduce_job(void *arg) {
+    reduce_job_t *job = arg;
+    switch (job->kind) {
+        case REDUCE_SUM:
+            job->sum = sum_range(job->arr, job->size);
+            break;
+        case REDUCE_MAX:
+            utils_array_max(job->arr, job->size, &job->extreme);
+            break;
+        case REDUCE_MIN:
+            utils_array_min(job->arr, job->size, &job->extreme);
+            break;
+    }
+    return NULL;
+}
+
+// 切分数组并运行任务，返回任务数（至少1）/ Split the array and run the jobs; returns the job count (at least 1)
+static size_t reduce_parallel(const int *arr, size_t size, int threads, reduce_kind_t kind,
+                              reduce_job_t *jobs) {
+    size_t n = threads > 0 ? (size_t)threads : (size_t)utils_cpu_count();
+    if (n > UTILS_MAX_THREADS) {
+        n = UTILS_MAX_THREADS;
+    }
+    if (n > size / UTILS_PARALLEL_MIN_CHUNK) {
+        n = size / UTILS_PARALLEL_MIN_CHUNK;
+    }
+    if (n < 1) {
+        n = 1;
+    }
+
+    // 分界点向下对齐到64字节，相邻线程不会读同一缓存行
+    // Boundaries are rounded down to 64 bytes so neighbouring threads never read the same cache line
+    uintptr_t base = (uintptr_t)arr;
+    size_t begin = 0;
+    for (size_t t = 0; t < n; t++) {
+        size_t end = size;
+        if (t + 1 < n) {
+            uintptr_t cut = (base + (size / n) * (t + 1) * sizeof(int)) & ~(uintptr_t)63;
+            end = (size_t)(cut - base) / sizeof(int);
         }
+        jobs[t].arr = arr + begin;
+        jobs[t].size = end - begin;
+        jobs[t].kind = kind;
+        begin = end;
+    }
+    if (n == 1) {
+        reduce_job(&jobs[0]);
+        return 1;
+    }
+
+    utils_run_jobs(jobs, sizeof(reduce_job_t), n, reduce_job);
+    return n;
+}
+
+// CPU核数 / Number of CPU cores
+int utils_cpu_count(void) {
+    long n = 1;
+#if !defined(_WIN32) && !defined(_WIN64)
+    n = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+    const char *env = getenv("NUMBER_OF_PROCESSORS");
+    if (env != NULL) {
+        n = strtol(env, NULL, 10);
+    }
+#endif
+    if (n < 1) {
+        n = 1;
+    }
+    return n > UTILS_MAX_THREADS ? UTILS_MAX_THREADS : (int)n;
+}
+
+// 每个任务一个线程；线程创建失败时在当前线程执行 / One thread per job; a job whose thread fails runs here
+void utils_run_jobs(void *jobs, size_t job_size, size_t count, void *(*fn)(void *)) {
+    char *base = jobs;
+    pthread_t handles[UTILS_MAX_THREADS];
+    bool started[UTILS_MAX_THREADS] = { false };
+    for (size_t t = 1; t < count && t < UTILS_MAX_THREADS; t++) {
+        started[t] = pthread_create(&handles[t], NULL, fn, base + t * job_size) == 0;
+    }
+    if (count > 0) {
+        fn(base);
+    }
+    for (size_t t = 1; t < count; t++) {
+        if (t < UTILS_MAX_THREADS && started[t]) {
+            pthread_join(handles[t], NULL);
+        } else {
+            fn(base + t * job_size);
+        }
+    }
+}
+
+// 多线程求和 / Parallel sum
+long long utils_array_sum_parallel(const int *arr, size_t size, int threads) {
+    if (arr == NULL || size == 0) {
+        return 0;
+    }
+    reduce_job_t jobs[UTILS_MAX_THREADS];
+    size_t n = reduce_parallel(arr, size, threads, REDUCE_SUM, jobs);
+    // 按段的顺序合并 / Combine in range order
+    long long sum = 0;
+    for (size_t t = 0; t < n; t++) {
+        sum += jobs[t].sum;
+    }
+    return sum;
+}
+
+// 多线程查找最大值 / Parallel maximum
+utils_status_t utils_array_max_parallel(const int *arr, size_t size, int threads, int *result) {
+    if (arr == NULL || result == NULL) {
+        return record_error(UTILS_ERROR_NULL, __func__, size, 0);
+    }
+    if (size == 0) {
+        return record_error(UTILS_ERROR_RANGE, __func__, size, 0);
+    }
+    reduce_job_t jobs[UTILS_MAX_THREADS];
+    size_t n = reduce_parallel(arr, size, threads, REDUCE_MAX, jobs);
+    int max = jobs[0].extreme;
+    for (size_t t = 1; t < n; t++) {
+        max = jobs[t].extreme > max ? jobs[t].extreme : max;
+    }
+    *result = max;
+    return UTILS_SUCCESS;
+}
+
+// 多线程查找最小值 / Parallel minimum
+utils_status_t utils_array_min_parallel(const int *arr, size_t size, int threads, int *result) {
+    if (arr == NULL || result == NULL) {
+        return record_error(UTILS_ERROR_NULL, __func__, size, 0);
+    }
+    if (size == 0) {
+        return record_error(UTILS_ERROR_RANGE, __func__, size, 0);
+    }
+    reduce_job_t jobs[UTILS_MAX_THREADS];
+    size_t n = reduce_parallel(arr, size, threads, REDUCE_MIN, jobs);
+    int min = jobs[0].extreme;
+    for (size_t t = 1; t < n; t++) {
+        min = jobs[t].extreme < min ? jobs[t].extreme : min;
     }
     *result = min;
     return UTILS_SUCCESS;
 }
 
 // 反转数组 / Reverse array
+//
+// 有SSE2时两端各读8个int，用pshufd在寄存器内倒序，再交叉写回另一端；中间不足16个时逐个交换
+// With SSE2, 8 ints are loaded from each end, reversed in registers with pshufd and stored crosswise
+// at the opposite end; the fewer than 16 left in the middle are swapped one at a time
+static void reverse_range(int *arr, size_t lo, size_t hi) {
+#if defined(__SSE2__)
+    for (; hi - lo >= 16; lo += 8, hi -= 8) {
+        __m128i front0 = _mm_loadu_si128((const __m128i *)(arr + lo));
+        __m128i front1 = _mm_loadu_si128((const __m128i *)(arr + lo + 4));
+        __m128i back0 = _mm_loadu_si128((const __m128i *)(arr + hi - 8));
+        __m128i back1 = _mm_loadu_si128((const __m128i *)(arr + hi - 4));
+        _mm_storeu_si128((__m128i *)(arr + lo), _mm_shuffle_epi32(back1, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128((__m128i *)(arr + lo + 4), _mm_shuffle_epi32(back0, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128((__m128i *)(arr + hi - 8), _mm_shuffle_epi32(front1, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128((__m128i *)(arr + hi - 4), _mm_shuffle_epi32(front0, _MM_SHUFFLE(0, 1, 2, 3)));
+    }
+#endif
+    for (; hi - lo >= 2; lo++, hi--) {
+        int temp = arr[lo];
+        arr[lo] = arr[hi - 1];
+        arr[hi - 1] = temp;
+    }
+}
+
 void utils_array_reverse(int *arr, size_t size) {
     if (arr == NULL || size <= 1) {
         return;
     }
-    
-    for (size_t i = 0; i < size / 2; i++) {
-        int temp = arr[i];
-        arr[i] = arr[size - 1 - i];
-        arr[size - 1 - i] = temp;
+    reverse_range(arr, 0, size);
+}
+
+// 循环左移数组 / Rotate array left
+//
+// 较短的一段不超过UTILS_ROTATE_BUFFER个元素时，先存到栈上，memmove另一段，再把它放回，
+// 每个元素只移动一次；否则用三次反转：rev(前k个)、rev(其余)、rev(全部)，不需要额外内存
+// When the shorter part has at most UTILS_ROTATE_BUFFER elements it is saved on the stack, the other part
+// is moved with memmove and the saved part is put back, moving each element once; otherwise three
+// reversals are used: rev(first k), rev(rest), rev(all), with no extra memory
+void utils_array_rotate(int *arr, size_t size, size_t shift) {
+    if (arr == NULL || size <= 1) {
+        return;
     }
+    shift %= size;
+    if (shift == 0) {
+        return;
+    }
+    size_t rest = size - shift;
+    int buffer[UTILS_ROTATE_BUFFER];
+    if (shift <= UTILS_ROTATE_BUFFER) {
+        memcpy(buffer, arr, shift * sizeof(int));
+        memmove(arr, arr + shift, rest * sizeof(int));
+        memcpy(arr + rest, buffer, shift * sizeof(int));
+    } else if (rest <= UTILS_ROTATE_BUFFER) {
+        memcpy(buffer, arr + shift, rest * sizeof(int));
+        memmove(arr + rest, arr, shift * sizeof(int));
+        memcpy(arr, buffer, rest * sizeof(int));
+    } else {
+        reverse_range(arr, 0, shift);
+        reverse_range(arr, shift, size);
+        reverse_range(arr, 0, size);
+    }
+}
+
+// =====================================================================
+// 选择 / Selection
+// =====================================================================
+
+// 不超过这个长度的区间直接插入排序 / Ranges of at most this length are insertion sorted
+#define SELECT_INSERTION 16
+
+static void swap_int(int *a, int *b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+// 插入排序闭区间[lo, hi] / Insertion sort the closed range [lo, hi]
+static void insertion_sort(int *arr, size_t lo, size_t hi) {
+    for (size_t i = lo + 1; i <= hi; i++) {
+        int value = arr[i];
+        size_t j = i;
+        while (j > lo && arr[j - 1] > value) {
+            arr[j] = arr[j - 1];
+            j--;
+        }
+        arr[j] = value;
+    }
+}
+
+// 三个下标中值居中的那个 / The index of the three whose value is in the middle
+static size_t median_of_three(const int *arr, size_t a, size_t b, size_t c) {
+    if (arr[a] < arr[b]) {
+        if (arr[b] < arr[c]) {
+            return b;
+        }
+        return arr[a] < arr[c] ? c : a;
+    }
+    if (arr[a] < arr[c]) {
+        return a;
+    }
+    return arr[b] < arr[c] ? c : b;
+}
+
+// Hoare划分，枢轴在arr[lo]；返回j（lo <= j < hi），[lo, j]都不大于[j + 1, hi]
+// Hoare partition with the pivot at arr[lo]; returns j (lo <= j < hi) with [lo, j] no greater than [j + 1, hi]
+static size_t partition(int *arr, size_t lo, size_t hi) {
+    int pivot = arr[lo];
+    size_t i = lo, j = hi;
+    for (;;) {
+        while (arr[i] < pivot) {
+            i++;
+        }
+        while (arr[j] > pivot) {
+            j--;
+        }
+        if (i >= j) {
+            return j;
+        }
+        swap_int(&arr[i], &arr[j]);
+        i++;
+        j--;
+    }
+}
+
+static void select_range(int *arr, size_t lo, size_t hi, size_t n);
+
+// 中位数的中位数：每5个一组取中位数移到区间开头，再递归选出它们的中位数，返回其下标；
+// 它保证至少有约3/10的元素在枢轴两侧各一边
+// Median of medians: the median of every group of 5 is moved to the front of the range and the median of
+// those is selected recursively; returns its index. At least about 3/10 of the elements are guaranteed
+// to fall on each side of this pivot
+static size_t median_of_medians(int *arr, size_t lo, size_t hi) {
+    size_t groups = 0;
+    for (size_t i = lo; i + 4 <= hi; i += 5) {
+        insertion_sort(arr, i, i + 4);
+        swap_int(&arr[lo + groups], &arr[i + 2]);
+        groups++;
+    }
+    size_t mid = lo + groups / 2;
+    select_range(arr, lo, lo + groups - 1, mid);
+    return mid;
+}
+
+// 内省选择：重排闭区间[lo, hi]，使arr[n]就位，左边都不大于它，右边都不小于它
+// Introselect: reorders the closed range [lo, hi] so that arr[n] is in its sorted place, with nothing
+// greater to its left and nothing smaller to its right
+//
+// 平时用三数取中的快速选择；每两轮检查一次区间是否至少减半，没有就改用中位数的中位数，
+// 直到又能减半为止，所以最坏情况也是线性时间
+// Quickselect with median-of-three pivots normally; every two rounds the range must have at least halved,
+// and if it has not, median-of-medians pivots are used until it does again, so even the worst case is linear
+static void select_range(int *arr, size_t lo, size_t hi, size_t n) {
+    size_t checkpoint = hi - lo + 1;
+    bool slow = false;
+    for (unsigned round = 1; hi - lo >= SELECT_INSERTION; round++) {
+        size_t pivot = slow ? median_of_medians(arr, lo, hi)
+                            : median_of_three(arr, lo, lo + (hi - lo) / 2, hi);
+        swap_int(&arr[lo], &arr[pivot]);
+        size_t j = partition(arr, lo, hi);
+        if (n <= j) {
+            hi = j;
+        } else {
+            lo = j + 1;
+        }
+        if (round % 2 == 0) {
+            size_t length = hi - lo + 1;
+            slow = length > checkpoint / 2;
+            checkpoint = length;
+        }
+    }
+    insertion_sort(arr, lo, hi);
+}
+
+// 最小堆的下沉 / Sift down in a min-heap
+static void heap_sift_down(int *heap, size_t count, size_t i) {
+    int value = heap[i];
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && heap[child + 1] < heap[child]) {
+            child++;
+        }
+        if (heap[child] >= value) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = value;
+}
+
+static void heap_build(int *heap, size_t count) {
+    for (size_t i = count / 2; i-- > 0;) {
+        heap_sift_down(heap, count, i);
+    }
+}
+
+// 堆排序成降序：每次把最小值换到末尾 / Heap sort into descending order: the minimum is swapped to the end each time
+static void heap_sort_descending(int *heap, size_t count) {
+    for (size_t end = count; end > 1; end--) {
+        swap_int(&heap[0], &heap[end - 1]);
+        heap_sift_down(heap, end - 1, 0);
+    }
+}
+
+// 第n小的元素 / The n-th smallest element
+utils_status_t utils_array_nth(int *arr, size_t size, size_t n, int *result) {
+    if (arr == NULL || result == NULL) {
+        return record_error(UTILS_ERROR_NULL, __func__, size, n);
+    }
+    if (n >= size) {
+        return record_error(UTILS_ERROR_RANGE, __func__, size, n);
+    }
+    select_range(arr, 0, size - 1, n);
+    *result = arr[n];
+    return UTILS_SUCCESS;
+}
+
+// 第n小的元素，值和状态码一起用寄存器返回 / The n-th smallest element, returning value and status in registers
+utils_value_t utils_array_nth_value(int *arr, size_t size, size_t n) {
+    if (arr == NULL) {
+        return value_error(UTILS_ERROR_NULL, __func__, size, n);
+    }
+    if (n >= size) {
+        return value_error(UTILS_ERROR_RANGE, __func__, size, n);
+    }
+    select_range(arr, 0, size - 1, n);
+    utils_value_t result = { arr[n], UTILS_SUCCESS };
+    return result;
+}
+
+// 最大的k个元素 / The k largest elements
+//
+// 先在result里维护k个元素的最小堆，大多数元素只和堆顶比较一次就被丢弃，不分配内存；
+// 但输入接近升序时几乎每个元素都要进堆，所以进堆次数超过size / 32（或k大于UTILS_TOPK_HEAP_MAX）时
+// 改为复制数组，用内省选择把最大的k个分到末尾，复制失败就继续用堆。最后都用堆排序排成降序
+// A min-heap of k elements is kept in result first, and most elements are rejected after a single
+// comparison with its top, with no allocation; but nearly every element enters the heap when the input is
+// close to ascending, so after more than size / 32 insertions (or when k exceeds UTILS_TOPK_HEAP_MAX) the
+// array is copied and introselect moves the k largest to the end, staying with the heap if the copy cannot
+// be allocated. Either way the result is finally heap sorted into descending order
+utils_status_t utils_array_topk(const int *arr, size_t size, size_t k, int *result) {
+    if (arr == NULL || result == NULL) {
+        return record_error(UTILS_ERROR_NULL, __func__, size, k);
+    }
+    if (k > size) {
+        return record_error(UTILS_ERROR_RANGE, __func__, size, k);
+    }
+    if (k == 0) {
+        return UTILS_SUCCESS;
+    }
+    memcpy(result, arr, k * sizeof(int));
+    heap_build(result, k);
+    size_t budget = k <= UTILS_TOPK_HEAP_MAX ? size / 32 : 0;
+    size_t i = k;
+    for (; i < size; i++) {
+        if (arr[i] > result[0]) {
+            if (budget == 0) {
+                break;
+            }
+            budget--;
+            result[0] = arr[i];
+            heap_sift_down(result, k, 0);
+        }
+    }
+    if (i < size) {
+        int *copy = malloc(size * sizeof(int));
+        if (copy != NULL) {
+            memcpy(copy, arr, size * sizeof(int));
+            select_range(copy, 0, size - 1, size - k);
+            memcpy(result, copy + (size - k), k * sizeof(int));
+            free(copy);
+            heap_build(result, k);
+        } else {
+            for (; i < size; i++) {
+                if (arr[i] > result[0]) {
+                    result[0] = arr[i];
+                    heap_sift_down(result, k, 0);
+                }
+            }
+        }
+    }
+    heap_sort_descending(result, k);
+    return UTILS_SUCCESS;
 }
 
 // 检查字符串是否为空或NULL / Check if string is empty or NULL
@@ -108,6 +821,26 @@ bool utils_string_is_empty(const char *str) {
     return (str == NULL || str[0] == '\0');
 }
 
+// 当前线程最近一次失败 / The current thread's latest failure
+const utils_error_t *utils_last_error(void) {
+    return &last_error;
+}
+
+// 清除当前线程的错误上下文 / Clear the current thread's error context
+void utils_clear_error(void) {
+    memset(&last_error, 0, sizeof(last_error));
+}
+
+// 到这时才把错误上下文格式化成消息 / The error context is only formatted into a message here
+const char *utils_last_error_message(void) {
+    if (last_error.status == UTILS_SUCCESS) {
+        return utils_status_message(UTILS_SUCCESS);
+    }
+    snprintf(last_error_message, sizeof(last_error_message), "%s: %s (size %zu, argument %zu)",
+             last_error.function, utils_status_message(last_error.status), last_error.size, last_error.argument);
+    return last_error_message;
+}
+
 // 获取状态码的描述信息 / Get status code description
 const char* utils_status_message(utils_status_t status) {
     switch (status) {
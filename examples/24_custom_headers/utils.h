@@ -42,6 +42,21 @@
 // 数组长度宏 / Array length macro
 #define UTILS_ARRAY_LEN(arr) (sizeof(arr) / sizeof((arr)[0]))
 
+// 并行归约的最大线程数 / Maximum threads of the parallel reductions
+#define UTILS_MAX_THREADS 64
+
+// 并行归约中每个线程至少分到的元素数；数组小于它的两倍时不建线程
+// Minimum elements per thread in the parallel reductions; arrays shorter than twice this stay serial
+#define UTILS_PARALLEL_MIN_CHUNK (256 * 1024)
+
+// utils_array_rotate中较短一段不超过它时用栈缓冲区，否则用三次反转
+// utils_array_rotate uses a stack buffer when the shorter part is at most this long, otherwise three reversals
+#define UTILS_ROTATE_BUFFER 256
+
+// utils_array_topk的k不超过它时先尝试最小堆，否则直接复制数组后做选择
+// utils_array_topk tries a min-heap first when k is at most this, otherwise it copies the array and selects
+#define UTILS_TOPK_HEAP_MAX 4096
+
 // 版本信息 / Version information
 #define UTILS_VERSION_MAJOR 1
 #define UTILS_VERSION_MINOR 0
@@ -66,12 +81,55 @@ typedef enum {
 } utils_status_t;
 
 // 结果结构体 / Result structure
+//
+// 每次返回都要通过隐藏指针复制72字节（其中64字节是message），成功时也一样；新代码用utils_value_t
+// Every return copies 72 bytes through a hidden pointer (64 of them the message), even on success;
+// new code should use utils_value_t
 typedef struct {
     int value;              // 结果值 / Result value
     utils_status_t status;  // 状态码 / Status code
     char message[64];       // 消息 / Message
 } utils_result_t;
 
+// 紧凑的返回值：值和状态码共8字节，x86-64和AArch64上用一个寄存器返回；
+// 失败的细节不放在这里，而是写进线程局部的错误上下文（utils_last_error）
+// Compact return value: value and status take 8 bytes and come back in one register on x86-64 and AArch64;
+// failure details are not carried here but written to a thread-local error context (utils_last_error)
+typedef struct {
+    int value;              // 结果值，失败时为0 / Result value, 0 on failure
+    utils_status_t status;  // 状态码 / Status code
+} utils_value_t;
+
+// 错误上下文：utils.c中返回状态码的函数失败时写入当前线程的这一份，成功时不碰它
+// Error context: the status-returning functions of utils.c write the current thread's copy when they fail
+// and leave it alone on success
+typedef struct {
+    utils_status_t status;  // 状态码，UTILS_SUCCESS表示没有记录 / Status code, UTILS_SUCCESS when nothing is recorded
+    const char *function;   // 失败的函数名 / Name of the failing function
+    size_t size;            // 数组大小参数 / Array size argument
+    size_t argument;        // 其他参数（n、k），没有时为0 / Other argument (n, k), 0 if none
+} utils_error_t;
+
+// 数组统计结果 / Array statistics
+typedef struct {
+    long long sum;          // 元素之和（64位累加）/ Sum of elements (accumulated in 64 bits)
+    int min;                // 最小值 / Minimum
+    int max;                // 最大值 / Maximum
+    double mean;            // 平均值 / Mean
+    double variance;        // 总体方差 / Population variance
+} utils_stats_t;
+
+// 流式统计累加器：逐个或逐块加入数据，可以合并
+// Streaming statistics accumulator: values are added one at a time or a block at a time, and accumulators merge
+typedef struct {
+    unsigned long long count;   // 已加入的值的个数 / Number of values added
+    long long sum;              // 和（溢出时回绕）/ Sum (wraps on overflow)
+    int min;                    // 最小值（count为0时是INT_MAX）/ Minimum (INT_MAX while count is 0)
+    int max;                    // 最大值（count为0时是INT_MIN）/ Maximum (INT_MIN while count is 0)
+    double mean;                // 均值（Welford）/ Mean (Welford)
+    double m2;                  // 与均值之差的平方和 / Sum of squared differences from the mean
+} utils_accum_t;
+
 // =====================================================================
 // 函数声明 / Function Declarations
 // =====================================================================
@@ -118,13 +176,202 @@ utils_status_t utils_array_max(const int *arr, size_t size, int *result);
  */
 utils_status_t utils_array_min(const int *arr, size_t size, int *result);
 
+/**
+ * 查找最大值，值和状态码一起用寄存器返回 / Find the maximum, returning value and status together in registers
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小 / Array size
+ * @return 最大值和状态码；失败的细节见utils_last_error / Maximum and status; see utils_last_error for failure details
+ */
+utils_value_t utils_array_max_value(const int *arr, size_t size);
+
+/**
+ * 查找最小值，值和状态码一起用寄存器返回 / Find the minimum, returning value and status together in registers
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小 / Array size
+ * @return 最小值和状态码；失败的细节见utils_last_error / Minimum and status; see utils_last_error for failure details
+ */
+utils_value_t utils_array_min_value(const int *arr, size_t size);
+
+/**
+ * 一次遍历计算数组的和、最小值、最大值、平均值和方差
+ * Compute the sum, minimum, maximum, mean and variance of an array in one pass
+ *
+ * 比分别调用sum、average、max、min少读三遍内存；有SSE2时每次处理8个元素
+ * Reads memory once instead of four times as with separate sum, average, max and min calls;
+ * processes 8 elements per step with SSE2
+ *
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小 / Array size
+ * @param result 结果指针 / Result pointer
+ * @return 状态码 / Status code
+ */
+utils_status_t utils_array_stats(const int *arr, size_t size, utils_stats_t *result);
+
+/**
+ * 初始化流式统计累加器 / Initialize a streaming statistics accumulator
+ * 参数为NULL时什么都不做，错误记录在utils_last_error / A NULL argument does nothing and is recorded in utils_last_error
+ * @param acc 累加器 / Accumulator
+ */
+void utils_accum_init(utils_accum_t *acc);
+
+/**
+ * 加入一个值（Welford更新）/ Add one value (Welford update)
+ * 参数为NULL时什么都不做，错误记录在utils_last_error / A NULL argument does nothing and is recorded in utils_last_error
+ * @param acc 累加器 / Accumulator
+ * @param value 值 / Value
+ */
+void utils_accum_add(utils_accum_t *acc, int value);
+
+/**
+ * 加入一块数据：用utils_array_stats一次遍历算出这块的统计量，再合并进来
+ * Add a block of values: utils_array_stats computes the block's statistics in one pass, which are then merged in
+ *
+ * @param acc 累加器 / Accumulator
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小，可以为0 / Array size, may be 0
+ * @return 状态码 / Status code
+ */
+utils_status_t utils_accum_add_array(utils_accum_t *acc, const int *arr, size_t size);
+
+/**
+ * 把other合并进acc，O(1)；结果与把两边的数据加进同一个累加器相同（浮点舍入除外）
+ * Merge other into acc in O(1); the result equals adding both sides' values to one accumulator
+ * (up to floating-point rounding)
+ *
+ * 每个线程或每个数据块用自己的累加器，最后合并
+ * Give every thread or data chunk its own accumulator and merge them at the end
+ *
+ * 参数为NULL时什么都不做，错误记录在utils_last_error / A NULL argument does nothing and is recorded in utils_last_error
+ *
+ * @param acc 累加器 / Accumulator
+ * @param other 要合并的累加器 / Accumulator to merge
+ */
+void utils_accum_merge(utils_accum_t *acc, const utils_accum_t *other);
+
+/**
+ * 总体方差 / Population variance
+ * @param acc 累加器 / Accumulator
+ * @return 方差，count为0或acc为NULL时返回0 / Variance, 0 when count is 0 or acc is NULL
+ */
+double utils_accum_variance(const utils_accum_t *acc);
+
+/**
+ * CPU核数 / Number of CPU cores
+ * @return 核数（1..UTILS_MAX_THREADS）/ Number of cores (1..UTILS_MAX_THREADS)
+ */
+int utils_cpu_count(void);
+
+/**
+ * 每个任务一个线程运行count个任务：任务0在当前线程运行，线程创建失败的任务（以及超过
+ * UTILS_MAX_THREADS的任务）也在当前线程运行，返回时全部完成
+ * Run count jobs with one thread each: job 0 runs on the calling thread, as do jobs whose thread
+ * fails to start (and jobs beyond UTILS_MAX_THREADS); all are done on return
+ *
+ * @param jobs 任务数组 / Job array
+ * @param job_size 每个任务的字节数 / Size of one job in bytes
+ * @param count 任务数 / Number of jobs
+ * @param fn 线程函数，参数是任务的地址 / Thread function, called with the address of a job
+ */
+void utils_run_jobs(void *jobs, size_t job_size, size_t count, void *(*fn)(void *));
+
+/**
+ * 多线程计算数组的和 / Sum an array with several threads
+ *
+ * 数组按64字节边界切成每线程一段，各线程的部分和按段的顺序合并，结果与线程数和调度无关
+ * The array is cut at 64-byte boundaries into one range per thread, and the partial sums are combined
+ * in range order, so the result does not depend on the thread count or scheduling
+ *
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小 / Array size
+ * @param threads 线程数，0表示CPU核数 / Number of threads, 0 for the number of CPU cores
+ * @return 数组元素之和 / Sum of array elements
+ */
+long long utils_array_sum_parallel(const int *arr, size_t size, int threads);
+
+/**
+ * 多线程查找最大值 / Find the maximum with several threads
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小 / Array size
+ * @param threads 线程数，0表示CPU核数 / Number of threads, 0 for the number of CPU cores
+ * @param result 结果指针 / Result pointer
+ * @return 状态码 / Status code
+ */
+utils_status_t utils_array_max_parallel(const int *arr, size_t size, int threads, int *result);
+
+/**
+ * 多线程查找最小值 / Find the minimum with several threads
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小 / Array size
+ * @param threads 线程数，0表示CPU核数 / Number of threads, 0 for the number of CPU cores
+ * @param result 结果指针 / Result pointer
+ * @return 状态码 / Status code
+ */
+utils_status_t utils_array_min_parallel(const int *arr, size_t size, int threads, int *result);
+
 /**
  * 反转数组 / Reverse array
+ *
+ * 有SSE2时每次从两端各处理8个元素 / Processes 8 elements from each end per step with SSE2
+ *
  * @param arr 数组指针 / Array pointer
  * @param size 数组大小 / Array size
  */
 void utils_array_reverse(int *arr, size_t size);
 
+/**
+ * 原地循环左移数组：arr[shift]移到arr[0] / Rotate an array left in place: arr[shift] moves to arr[0]
+ *
+ * 循环右移k位等于左移size - k位 / Rotating right by k equals rotating left by size - k
+ *
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小 / Array size
+ * @param shift 左移的位数，按size取模 / Positions to rotate left, taken modulo size
+ */
+void utils_array_rotate(int *arr, size_t size, size_t shift);
+
+/**
+ * 查找第n小的元素（从0开始，n = size / 2即中位数）/ Find the n-th smallest element (from 0; n = size / 2 is the median)
+ *
+ * 内省选择：三数取中的快速选择，进展太慢时改用中位数的中位数，最坏也是线性时间，不分配内存。
+ * 数组被原地重排：arr[n]就位，它前面的都不大于它，后面的都不小于它
+ * Introselect: quickselect with median-of-three pivots that switches to median of medians when it makes too
+ * little progress, so even the worst case is linear, with no allocation. The array is reordered in place:
+ * arr[n] ends up in its sorted position with nothing greater before it and nothing smaller after it
+ *
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小 / Array size
+ * @param n 排序后的下标，小于size / Index in sorted order, less than size
+ * @param result 结果指针 / Result pointer
+ * @return 状态码 / Status code
+ */
+utils_status_t utils_array_nth(int *arr, size_t size, size_t n, int *result);
+
+/**
+ * 同utils_array_nth，值和状态码一起用寄存器返回 / Same as utils_array_nth, returning value and status in registers
+ * @param arr 数组指针 / Array pointer
+ * @param size 数组大小 / Array size
+ * @param n 排序后的下标，小于size / Index in sorted order, less than size
+ * @return 元素和状态码 / Element and status
+ */
+utils_value_t utils_array_nth_value(int *arr, size_t size, size_t n);
+
+/**
+ * 取最大的k个元素，按降序写入result / Write the k largest elements to result in descending order
+ *
+ * k不超过UTILS_TOPK_HEAP_MAX时先用k个元素的最小堆，不分配内存；k更大或输入接近升序、
+ * 堆的更新太多时，复制数组并用内省选择。线性时间加上k个结果的排序
+ * Uses a min-heap of k elements first when k is at most UTILS_TOPK_HEAP_MAX, with no allocation; when k is
+ * larger, or the input is close to ascending and the heap is updated too often, copies the array and uses
+ * introselect. Linear time plus sorting the k results
+ *
+ * @param arr 数组指针（不修改）/ Array pointer (not modified)
+ * @param size 数组大小 / Array size
+ * @param k 元素个数，不超过size / Number of elements, at most size
+ * @param result 至少k个元素的输出数组 / Output array of at least k elements
+ * @return 状态码 / Status code
+ */
+utils_status_t utils_array_topk(const int *arr, size_t size, size_t k, int *result);
+
 /**
  * 检查字符串是否为空或NULL / Check if string is empty or NULL
  * @param str 字符串指针 / String pointer
@@ -132,6 +379,29 @@ void utils_array_reverse(int *arr, size_t size);
  */
 bool utils_string_is_empty(const char *str);
 
+/**
+ * 当前线程最近一次失败的上下文 / Context of the current thread's latest failure
+ *
+ * 成功的调用不会清除它，需要时先调用utils_clear_error / Successful calls do not clear it; call
+ * utils_clear_error first when needed
+ *
+ * @return 当前线程的错误上下文 / The current thread's error context
+ */
+const utils_error_t *utils_last_error(void);
+
+/**
+ * 清除当前线程的错误上下文 / Clear the current thread's error context
+ */
+void utils_clear_error(void);
+
+/**
+ * 把当前线程最近一次失败格式化成消息（只在调用时格式化）
+ * Format the current thread's latest failure as a message (formatted only when called)
+ *
+ * @return 消息，指向线程局部缓冲区，下次调用时被覆盖 / Message in a thread-local buffer, overwritten by the next call
+ */
+const char *utils_last_error_message(void);
+
 /**
  * 获取状态码的描述信息 / Get status code description
  * @param status 状态码 / Status code
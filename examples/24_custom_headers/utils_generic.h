@@ -0,0 +1,120 @@
+/**
+ * 类型泛型数组函数头文件 / Type-Generic Array Functions Header
+ *
+ * utils.h的数组函数只接受int；这里用宏模板为每种元素类型（8到64位有符号/无符号整数、float、double）
+ * 生成专用的sum、min、max、reverse和stats，再用C11的_Generic按指针类型分派，
+ * 调用者不必先把数组复制成int数组
+ * The array functions in utils.h only take int; here a macro template generates dedicated sum, min, max,
+ * reverse and stats functions for every element type (8- to 64-bit signed/unsigned integers, float and
+ * double), and C11 _Generic dispatches on the pointer type, so callers no longer copy arrays into int arrays
+ *
+ * 用法 / Usage:
+ *   float samples[1000];
+ *   double total = UTILS_ARRAY_SUM(samples, 1000);       // 调用 / calls utils_sum_f32
+ *   uint8_t pixels[4096], brightest;
+ *   UTILS_ARRAY_MAX(pixels, 4096, &brightest);           // 调用 / calls utils_max_u8
+ */
+
+#ifndef UTILS_GENERIC_H
+#define UTILS_GENERIC_H
+
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdint.h>   // 用于 int8_t...uint64_t / For int8_t...uint64_t
+#include "utils.h"    // 用于 utils_status_t / For utils_status_t
+
+// =====================================================================
+// 类型表 / Type Table
+// =====================================================================
+
+// X(后缀, 元素类型, 和的类型) / X(suffix, element type, sum type)
+// 整数的和在64位中累加（64位类型溢出时按2^64取模回绕），浮点数的和在double中累加
+// Integer sums are accumulated in 64 bits (wrapping modulo 2^64 for the 64-bit types on overflow);
+// floating-point sums are accumulated in double
+#define UTILS_GENERIC_TYPES(X)     \
+    X(i8,  int8_t,   int64_t)      \
+    X(u8,  uint8_t,  uint64_t)     \
+    X(i16, int16_t,  int64_t)      \
+    X(u16, uint16_t, uint64_t)     \
+    X(i32, int32_t,  int64_t)      \
+    X(u32, uint32_t, uint64_t)     \
+    X(i64, int64_t,  int64_t)      \
+    X(u64, uint64_t, uint64_t)     \
+    X(f32, float,    double)       \
+    X(f64, double,   double)
+
+// =====================================================================
+// 类型定义和函数声明 / Type Definitions and Function Declarations
+// =====================================================================
+
+/**
+ * 每种类型xx生成以下声明 / The following are declared for every type xx:
+ *
+ * utils_stats_xx_t
+ *   数组统计结果：sum、min、max、mean、variance（总体方差）
+ *   Array statistics: sum, min, max, mean, variance (population variance)
+ *
+ * S utils_sum_xx(const T *arr, size_t size)
+ *   数组元素之和，arr为NULL时返回0 / Sum of the elements, 0 when arr is NULL
+ *
+ * utils_status_t utils_min_xx(const T *arr, size_t size, T *result)
+ * utils_status_t utils_max_xx(const T *arr, size_t size, T *result)
+ *   最小值/最大值；数组含NaN时结果未定义
+ *   Minimum/maximum; the result is unspecified when the array contains NaN
+ *
+ * void utils_reverse_xx(T *arr, size_t size)
+ *   原地反转数组 / Reverse the array in place
+ *
+ * utils_status_t utils_stats_xx(const T *arr, size_t size, utils_stats_xx_t *result)
+ *   一次遍历计算统计结果；均值和方差在double中计算，方差累加与arr[0]的差以保持精度
+ *   One-pass statistics; the mean and variance are computed in double, and the variance accumulates
+ *   differences from arr[0] to keep its precision
+ *
+ * 返回状态码的函数：arr或result为NULL返回UTILS_ERROR_NULL，size为0返回UTILS_ERROR_RANGE
+ * Functions returning a status code return UTILS_ERROR_NULL when arr or result is NULL and
+ * UTILS_ERROR_RANGE when size is 0
+ */
+#define UTILS_GENERIC_DECLARE(xx, T, S)                                                        \
+    typedef struct {                                                                           \
+        S sum;                                                                                 \
+        T min;                                                                                 \
+        T max;                                                                                 \
+        double mean;                                                                           \
+        double variance;                                                                       \
+    } utils_stats_##xx##_t;                                                                    \
+    S utils_sum_##xx(const T *arr, size_t size);                                               \
+    utils_status_t utils_min_##xx(const T *arr, size_t size, T *result);                       \
+    utils_status_t utils_max_##xx(const T *arr, size_t size, T *result);                       \
+    void utils_reverse_##xx(T *arr, size_t size);                                              \
+    utils_status_t utils_stats_##xx(const T *arr, size_t size, utils_stats_##xx##_t *result);
+
+UTILS_GENERIC_TYPES(UTILS_GENERIC_DECLARE)
+
+// =====================================================================
+// _Generic分派 / _Generic Dispatch
+// =====================================================================
+
+// 按数组指针的类型选出 fn_xx / Pick fn_xx by the type of the array pointer
+// int、long、long long只有与某个intN_t是同一类型时才匹配（例如LP64上int64_t是long，long long不匹配）；
+// 普通char既不是int8_t也不是uint8_t，需要先转换指针
+// int, long and long long only match when they are the same type as some intN_t (on LP64, int64_t is
+// long, so long long does not match); plain char is neither int8_t nor uint8_t and needs a pointer cast
+#define UTILS_GENERIC_SELECT(arr, fn) _Generic((arr),                  \
+        int8_t *: fn##_i8,     const int8_t *: fn##_i8,                \
+        uint8_t *: fn##_u8,    const uint8_t *: fn##_u8,               \
+        int16_t *: fn##_i16,   const int16_t *: fn##_i16,              \
+        uint16_t *: fn##_u16,  const uint16_t *: fn##_u16,             \
+        int32_t *: fn##_i32,   const int32_t *: fn##_i32,              \
+        uint32_t *: fn##_u32,  const uint32_t *: fn##_u32,             \
+        int64_t *: fn##_i64,   const int64_t *: fn##_i64,              \
+        uint64_t *: fn##_u64,  const uint64_t *: fn##_u64,             \
+        float *: fn##_f32,     const float *: fn##_f32,                \
+        double *: fn##_f64,    const double *: fn##_f64)
+
+// 泛型数组函数 / Generic array functions
+#define UTILS_ARRAY_SUM(arr, size)              UTILS_GENERIC_SELECT(arr, utils_sum)(arr, size)
+#define UTILS_ARRAY_MIN(arr, size, result)      UTILS_GENERIC_SELECT(arr, utils_min)(arr, size, result)
+#define UTILS_ARRAY_MAX(arr, size, result)      UTILS_GENERIC_SELECT(arr, utils_max)(arr, size, result)
+#define UTILS_ARRAY_REVERSE(arr, size)          UTILS_GENERIC_SELECT(arr, utils_reverse)(arr, size)
+#define UTILS_ARRAY_STATS(arr, size, result)    UTILS_GENERIC_SELECT(arr, utils_stats)(arr, size, result)
+
+#endif // UTILS_GENERIC_H
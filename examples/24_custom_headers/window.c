@@ -0,0 +1,290 @@
+/**
+ * 滑动窗口聚合实现文件 / Sliding-Window Aggregates Implementation
+ *
+ * 最小值和最大值用单调队列：新样本从队尾进入前，先弹出队尾所有不比它更好的样本（求最小值时是不比它小的），
+ * 这些样本在新样本离开窗口之前都不可能成为答案；所以队列从头到尾按值单调，队头就是答案，
+ * 队头的样本离开窗口时出队。每个样本最多进出各一次，均摊O(1)。平均值用窗口内的累计和
+ * Minimum and maximum use monotonic queues: before a new sample enters at the back, every sample there
+ * that is no better (for the minimum, no smaller) is popped, since none of them can be the answer before
+ * the new sample leaves the window; the queue is therefore monotonic from front to back, its front is the
+ * answer, and the front is dropped when that sample leaves the window. Every sample enters and leaves at
+ * most once, amortized O(1). The mean uses a running sum of the window
+ */
+
+#include "window.h"
+#include <limits.h>   // 用于 LLONG_MIN / For LLONG_MIN
+#include <stdlib.h>   // 用于 malloc, free / For malloc, free
+#include <string.h>   // 用于 memset / For memset
+
+// =====================================================================
+// 内部函数 / Internal Functions
+// =====================================================================
+
+// 分配容量为capacity的缓冲区 / Allocate buffers with the given capacity
+static bool init_buffers(window_t *window, size_t capacity, bool timed) {
+    window->mask = capacity - 1;
+    window->values = malloc(capacity * sizeof(int));
+    window->min_queue = malloc(capacity * sizeof(unsigned long long));
+    window->max_queue = malloc(capacity * sizeof(unsigned long long));
+    window->times = timed ? malloc(capacity * sizeof(long long)) : NULL;
+    if (window->values == NULL || window->min_queue == NULL || window->max_queue == NULL ||
+        (timed && window->times == NULL)) {
+        window_free(window);
+        return false;
+    }
+    window->timed = timed;
+    window->latest = LLONG_MIN;
+    return true;
+}
+
+// 把环形队列[head, tail)搬到新容量的缓冲区 / Move the ring queue [head, tail) into a buffer of the new capacity
+static void move_queue(unsigned long long *to, size_t to_mask, const unsigned long long *from, size_t from_mask,
+                       unsigned long long head, unsigned long long tail) {
+    for (unsigned long long i = head; i != tail; i++) {
+        to[i & to_mask] = from[i & from_mask];
+    }
+}
+
+// 按时间的窗口容量加倍 / Double the capacity of a time window
+static bool grow(window_t *window) {
+    size_t capacity = (window->mask + 1) * 2;
+    size_t mask = capacity - 1;
+    int *values = malloc(capacity * sizeof(int));
+    long long *times = malloc(capacity * sizeof(long long));
+    unsigned long long *min_queue = malloc(capacity * sizeof(unsigned long long));
+    unsigned long long *max_queue = malloc(capacity * sizeof(unsigned long long));
+    if (values == NULL || times == NULL || min_queue == NULL || max_queue == NULL) {
+        free(values);
+        free(times);
+        free(min_queue);
+        free(max_queue);
+        return false;
+    }
+    for (unsigned long long seq = window->first; seq != window->next; seq++) {
+        values[seq & mask] = window->values[seq & window->mask];
+        times[seq & mask] = window->times[seq & window->mask];
+    }
+    move_queue(min_queue, mask, window->min_queue, window->mask, window->min_head, window->min_tail);
+    move_queue(max_queue, mask, window->max_queue, window->mask, window->max_head, window->max_tail);
+    free(window->values);
+    free(window->times);
+    free(window->min_queue);
+    free(window->max_queue);
+    window->values = values;
+    window->times = times;
+    window->min_queue = min_queue;
+    window->max_queue = max_queue;
+    window->mask = mask;
+    return true;
+}
+
+// 队头的样本已离开窗口时出队 / Drop queue fronts whose samples have left the window
+static void drop_queue_fronts(window_t *window) {
+    while (window->min_head != window->min_tail && window->min_queue[window->min_head & window->mask] < window->first) {
+        window->min_head++;
+    }
+    while (window->max_head != window->max_tail && window->max_queue[window->max_head & window->mask] < window->first) {
+        window->max_head++;
+    }
+}
+
+// 移出时间戳不大于now - span的样本 / Drop the samples with timestamps at or below now - span
+static void expire(window_t *window, long long now) {
+    if (now < LLONG_MIN + window->span) {
+        return;
+    }
+    long long cutoff = now - window->span;
+    while (window->first != window->next && window->times[window->first & window->mask] <= cutoff) {
+        window->sum -= window->values[window->first & window->mask];
+        window->first++;
+    }
+    drop_queue_fronts(window);
+}
+
+// 放入一个样本，调用前必须有空位 / Store one sample; there must be room for it
+static void push(window_t *window, long long time, int value) {
+    size_t mask = window->mask;
+    unsigned long long seq = window->next++;
+    window->values[seq & mask] = value;
+    if (window->times != NULL) {
+        window->times[seq & mask] = time;
+    }
+    window->sum += value;
+    while (window->min_tail != window->min_head &&
+           window->values[window->min_queue[(window->min_tail - 1) & mask] & mask] >= value) {
+        window->min_tail--;
+    }
+    window->min_queue[window->min_tail++ & mask] = seq;
+    while (window->max_tail != window->max_head &&
+           window->values[window->max_queue[(window->max_tail - 1) & mask] & mask] <= value) {
+        window->max_tail--;
+    }
+    window->max_queue[window->max_tail++ & mask] = seq;
+}
+
+// 按样本数的窗口：满了先移出最早的 / Count window: drop the oldest sample when full
+static void add_counted(window_t *window, int value) {
+    if (window->next - window->first == (unsigned long long)window->span) {
+        window->sum -= window->values[window->first & window->mask];
+        window->first++;
+        drop_queue_fronts(window);
+    }
+    push(window, 0, value);
+}
+
+// 按时间的窗口：先移出过期的样本，还满就扩容 / Time window: drop expired samples first, grow if still full
+static bool add_timed(window_t *window, long long time, int value) {
+    if (time < window->latest) {
+        time = window->latest;
+    }
+    window->latest = time;
+    expire(window, time);
+    if (window->next - window->first > window->mask && !grow(window)) {
+        return false;
+    }
+    push(window, time, value);
+    return true;
+}
+
+// =====================================================================
+// 函数实现 / Function Implementations
+// =====================================================================
+
+bool window_init(window_t *window, size_t length) {
+    memset(window, 0, sizeof(*window));
+    if (length == 0 || length > ((size_t)-1 >> 4)) {
+        return false;
+    }
+    size_t capacity = 1;
+    while (capacity < length) {
+        capacity <<= 1;
+    }
+    window->span = (long long)length;
+    return init_buffers(window, capacity, false);
+}
+
+bool window_init_timed(window_t *window, long long span) {
+    memset(window, 0, sizeof(*window));
+    if (span < 1) {
+        return false;
+    }
+    window->span = span;
+    return init_buffers(window, WINDOW_INITIAL_CAPACITY, true);
+}
+
+void window_free(window_t *window) {
+    free(window->values);
+    free(window->times);
+    free(window->min_queue);
+    free(window->max_queue);
+    memset(window, 0, sizeof(*window));
+}
+
+bool window_add(window_t *window, int value) {
+    if (window->timed) {
+        return add_timed(window, window->latest, value);
+    }
+    add_counted(window, value);
+    return true;
+}
+
+bool window_add_array(window_t *window, const int *values, size_t count) {
+    if (window->timed) {
+        for (size_t i = 0; i < count; i++) {
+            if (!add_timed(window, window->latest, values[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    // 批次不短于窗口时，之前的样本和批内前面的样本都会被移出，直接清空窗口并跳过它们
+    // When the batch is at least as long as the window, the earlier samples and the front of the batch
+    // would all be dropped, so the window is emptied and they are skipped
+    size_t length = (size_t)window->span;
+    if (count >= length) {
+        window->next += count - length;
+        window->first = window->next;
+        window->min_head = window->min_tail;
+        window->max_head = window->max_tail;
+        window->sum = 0;
+        values += count - length;
+        count = length;
+    }
+    for (size_t i = 0; i < count; i++) {
+        add_counted(window, values[i]);
+    }
+    return true;
+}
+
+bool window_add_at(window_t *window, long long time, int value) {
+    if (!window->timed) {
+        add_counted(window, value);
+        return true;
+    }
+    return add_timed(window, time, value);
+}
+
+bool window_add_array_at(window_t *window, const long long *times, const int *values, size_t count) {
+    if (!window->timed) {
+        return window_add_array(window, values, count);
+    }
+    if (count == 0) {
+        return true;
+    }
+    // 二分查找批内第一个在最后一个样本的窗口内的样本，前面的直接跳过
+    // Binary search for the first sample of the batch inside the last sample's window and skip those before it
+    size_t start = 0;
+    long long last = times[count - 1] > window->latest ? times[count - 1] : window->latest;
+    if (last >= LLONG_MIN + window->span && window->latest <= last - window->span) {
+        long long cutoff = last - window->span;
+        size_t lo = 0, hi = count;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (times[mid] <= cutoff) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        start = lo;
+    }
+    for (size_t i = start; i < count; i++) {
+        if (!add_timed(window, times[i], values[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void window_advance(window_t *window, long long now) {
+    if (!window->timed || now < window->latest) {
+        return;
+    }
+    window->latest = now;
+    expire(window, now);
+}
+
+size_t window_count(const window_t *window) {
+    return (size_t)(window->next - window->first);
+}
+
+bool window_min(const window_t *window, int *result) {
+    if (window->min_head == window->min_tail) {
+        return false;
+    }
+    *result = window->values[window->min_queue[window->min_head & window->mask] & window->mask];
+    return true;
+}
+
+bool window_max(const window_t *window, int *result) {
+    if (window->max_head == window->max_tail) {
+        return false;
+    }
+    *result = window->values[window->max_queue[window->max_head & window->mask] & window->mask];
+    return true;
+}
+
+double window_mean(const window_t *window) {
+    size_t count = window_count(window);
+    return count == 0 ? 0.0 : (double)window->sum / (double)count;
+}
@@ -0,0 +1,159 @@
+/**
+ * 滑动窗口聚合头文件 / Sliding-Window Aggregates Header
+ *
+ * 对int样本流维护最近一个窗口内的最小值、最大值和平均值，每个样本均摊O(1)，与窗口长度无关。
+ * 窗口可以是最近N个样本，也可以是最近一段时间（时间戳单位由调用者决定，例如毫秒）
+ * Keeps the minimum, maximum and mean of the latest window of a stream of int samples in amortized O(1)
+ * per sample, whatever the window length. A window is either the last N samples or the last span of time
+ * (the timestamp unit is up to the caller, e.g. milliseconds)
+ */
+
+#ifndef WINDOW_H
+#define WINDOW_H
+
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stddef.h>   // 用于 size_t / For size_t
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 按时间的窗口最初能放的样本数，之后按需加倍 / Initial sample capacity of a time window, doubled as needed
+#define WINDOW_INITIAL_CAPACITY 64
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 滑动窗口：样本、最小值队列和最大值队列都是环形缓冲区，用序号的低位作下标
+// Sliding window: the samples and the minimum and maximum queues are ring buffers indexed by the low bits
+// of running sequence numbers
+typedef struct {
+    long long span;                 // 窗口长度：样本数，或按时间时的时间跨度 / Length: samples, or a time span
+    bool timed;                     // 是否按时间 / Whether the window is time-based
+    size_t mask;                    // 容量 - 1（容量是2的幂）/ Capacity - 1 (capacity is a power of two)
+    int *values;                    // 样本值 / Sample values
+    long long *times;               // 样本时间戳，按样本数时为NULL / Sample timestamps, NULL for count windows
+    unsigned long long first;       // 窗口内最早样本的序号 / Sequence number of the oldest sample in the window
+    unsigned long long next;        // 下一个样本的序号 / Sequence number of the next sample
+    unsigned long long *min_queue;  // 值递增的样本序号 / Sequence numbers with increasing values
+    unsigned long long min_head, min_tail;
+    unsigned long long *max_queue;  // 值递减的样本序号 / Sequence numbers with decreasing values
+    unsigned long long max_head, max_tail;
+    long long sum;                  // 窗口内样本之和 / Sum of the samples in the window
+    long long latest;               // 最近的时间戳 / Latest timestamp
+} window_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 初始化保留最近length个样本的窗口，内存一次分配好
+ * Initialize a window over the last length samples, allocating its memory up front
+ *
+ * @param window 窗口 / Window
+ * @param length 样本数，至少1 / Number of samples, at least 1
+ * @return 成功返回true，length为0或内存不足返回false / true on success, false for length 0 or out of memory
+ */
+bool window_init(window_t *window, size_t length);
+
+/**
+ * 初始化按时间的窗口：保留时间戳在(latest - span, latest]内的样本
+ * Initialize a time window holding the samples with timestamps in (latest - span, latest]
+ *
+ * @param window 窗口 / Window
+ * @param span 时间跨度，至少1 / Time span, at least 1
+ * @return 成功返回true，span无效或内存不足返回false / true on success, false for a bad span or out of memory
+ */
+bool window_init_timed(window_t *window, long long span);
+
+/**
+ * 释放窗口 / Free a window
+ * @param window 窗口 / Window
+ */
+void window_free(window_t *window);
+
+/**
+ * 加入一个样本；按时间的窗口沿用最近的时间戳 / Add one sample; a time window reuses the latest timestamp
+ * @param window 窗口 / Window
+ * @param value 样本值 / Sample value
+ * @return 按时间的窗口扩容失败时返回false / false when a time window fails to grow
+ */
+bool window_add(window_t *window, int value);
+
+/**
+ * 批量加入样本；按样本数的窗口只处理最后length个 / Add a batch; a count window only processes the last length
+ * @param window 窗口 / Window
+ * @param values 样本值数组 / Sample values
+ * @param count 个数 / Number of samples
+ * @return 按时间的窗口扩容失败时返回false / false when a time window fails to grow
+ */
+bool window_add_array(window_t *window, const int *values, size_t count);
+
+/**
+ * 加入一个带时间戳的样本 / Add one timestamped sample
+ *
+ * 时间戳不能减小，比最近的小时按最近的算；按样本数的窗口忽略时间戳
+ * Timestamps must not decrease, and one smaller than the latest counts as the latest; count windows
+ * ignore timestamps
+ *
+ * @param window 窗口 / Window
+ * @param time 时间戳 / Timestamp
+ * @param value 样本值 / Sample value
+ * @return 扩容失败时返回false / false when the window fails to grow
+ */
+bool window_add_at(window_t *window, long long time, int value);
+
+/**
+ * 批量加入带时间戳的样本；批内在窗口之外的样本直接跳过
+ * Add a batch of timestamped samples; those already outside the window within the batch are skipped
+ *
+ * @param window 窗口 / Window
+ * @param times 不减的时间戳数组 / Non-decreasing timestamps
+ * @param values 样本值数组 / Sample values
+ * @param count 个数 / Number of samples
+ * @return 扩容失败时返回false / false when the window fails to grow
+ */
+bool window_add_array_at(window_t *window, const long long *times, const int *values, size_t count);
+
+/**
+ * 时间前进到now，移出过期的样本（没有新样本时也要调用）
+ * Advance time to now and drop expired samples (call it even when no new samples arrive)
+ *
+ * @param window 按时间的窗口 / Time window
+ * @param now 当前时间，比最近的小时忽略 / Current time, ignored when smaller than the latest
+ */
+void window_advance(window_t *window, long long now);
+
+/**
+ * 窗口内的样本数 / Number of samples in the window
+ * @param window 窗口 / Window
+ * @return 样本数 / Number of samples
+ */
+size_t window_count(const window_t *window);
+
+/**
+ * 窗口内的最小值 / Minimum of the window
+ * @param window 窗口 / Window
+ * @param result 结果指针 / Result pointer
+ * @return 窗口为空时返回false / false when the window is empty
+ */
+bool window_min(const window_t *window, int *result);
+
+/**
+ * 窗口内的最大值 / Maximum of the window
+ * @param window 窗口 / Window
+ * @param result 结果指针 / Result pointer
+ * @return 窗口为空时返回false / false when the window is empty
+ */
+bool window_max(const window_t *window, int *result);
+
+/**
+ * 窗口内的平均值 / Mean of the window
+ * @param window 窗口 / Window
+ * @return 平均值，窗口为空时返回0 / Mean, 0 when the window is empty
+ */
+double window_mean(const window_t *window);
+
+#endif // WINDOW_H
@@ -0,0 +1,452 @@
+/**
+ * 词频统计实现文件 / Word Frequency Implementation
+ *
+ * 两个并行阶段 / Two parallel phases:
+ *   1. 统计：每个线程扫描自己的文本段，计入私有哈希表，线程之间没有共享写入
+ *      Count: each thread scans its own range into a private hash table; threads share no writes
+ *   2. 合并：按哈希值把单词分成与线程数相同的分区，每个线程从所有私有表中收集自己分区的单词
+ *      Merge: words are split into as many partitions as threads by hash, and each thread gathers its
+ *      partition's words from every private table
+ *
+ * 哈希表只保存指向文本的指针，不复制单词。
+ * The hash tables only hold pointers into the text; words are never copied.
+ */
+
+// mmap需要POSIX声明 / mmap needs the POSIX declarations
+#define _POSIX_C_SOURCE 200809L
+
+#include "word_freq.h"
+#include "hash.h"     // 用于 hash64 / For hash64
+#include "string_utils.h"  // 用于 STR_IS_SPACE / For STR_IS_SPACE
+#include "utils.h"    // 用于 utils_cpu_count, utils_run_jobs / For utils_cpu_count, utils_run_jobs
+#include <stdio.h>    // 用于 fopen（Windows）/ For fopen (Windows)
+#include <stdlib.h>   // 用于 malloc, calloc, free, qsort / For malloc, calloc, free, qsort
+#include <string.h>   // 用于 memcmp / For memcmp
+
+#if defined(_WIN32) || defined(_WIN64)
+    #define WORD_FREQ_MMAP 0
+#else
+    #define WORD_FREQ_MMAP 1
+    #include <fcntl.h>     // 用于 open / For open
+    #include <sys/mman.h>  // 用于 mmap, munmap / For mmap, munmap
+    #include <sys/stat.h>  // 用于 fstat / For fstat
+    #include <unistd.h>    // 用于 close / For close
+#endif
+
+// 每个线程至少分到的字节数，文本太短时少用几个线程
+// Minimum bytes per thread; short texts use fewer threads
+#define WORD_FREQ_MIN_RANGE (64 * 1024)
+
+// 私有表的初始槽数 / Initial slots of a private table
+#define WORD_FREQ_INITIAL_CAPACITY 1024
+
+// =====================================================================
+// 哈希表 / Hash Table
+// =====================================================================
+
+// 一个槽 / One slot
+typedef struct {
+    const char *word;       // NULL表示空槽 / NULL for an empty slot
+    size_t len;
+    uint64_t hash;
+    uint64_t count;
+} wf_slot_t;
+
+// 线性探测哈希表 / Linear-probing hash table
+typedef struct {
+    wf_slot_t *slots;
+    size_t capacity;        // 2的幂 / A power of two
+    size_t count;
+} wf_table_t;
+
+static bool table_init(wf_table_t *table, size_t capacity) {
+    table->slots = calloc(capacity, sizeof(wf_slot_t));
+    table->capacity = capacity;
+    table->count = 0;
+    return table->slots != NULL;
+}
+
+static bool table_grow(wf_table_t *table) {
+    size_t capacity = table->capacity * 2;
+    wf_slot_t *slots = calloc(capacity, sizeof(wf_slot_t));
+    if (slots == NULL) {
+        return false;
+    }
+    size_t mask = capacity - 1;
+    for (size_t i = 0; i < table->capacity; i++) {
+        if (table->slots[i].word != NULL) {
+            size_t j = table->slots[i].hash & mask;
+            while (slots[j].word != NULL) {
+                j = (j + 1) & mask;
+            }
+            slots[j] = table->slots[i];
+        }
+    }
+    free(table->slots);
+    table->slots = slots;
+    table->capacity = capacity;
+    return true;
+}
+
+// 把count计入单词，负载因子保持在1/2以下 / Add count to a word, keeping the load factor under 1/2
+static bool table_add(wf_table_t *table, const char *word, size_t len, uint64_t hash, uint64_t count) {
+    size_t mask = table->capacity - 1;
+    size_t i = hash & mask;
+    for (;;) {
+        wf_slot_t *slot = &table->slots[i];
+        if (slot->word == NULL) {
+            break;
+        }
+        if (slot->hash == hash && slot->len == len && memcmp(slot->word, word, len) == 0) {
+            slot->count += count;
+            return true;
+        }
+        i = (i + 1) & mask;
+    }
+
+    if ((table->count + 1) * 2 > table->capacity) {
+        if (!table_grow(table)) {
+            return false;
+        }
+        mask = table->capacity - 1;
+        i = hash & mask;
+        while (table->slots[i].word != NULL) {
+            i = (i + 1) & mask;
+        }
+    }
+    table->slots[i] = (wf_slot_t){ word, len, hash, count };
+    table->count++;
+    return true;
+}
+
+// =====================================================================
+// 并行阶段 / Parallel Phases
+// =====================================================================
+
+// 一个线程的工作 / One thread's work
+typedef struct {
+    const unsigned char *begin;   // 统计阶段的文本段 / Text range for the count phase
+    const unsigned char *end;
+    wf_table_t table;             // 统计阶段的私有表 / Private table of the count phase
+    uint64_t words;
+    wf_table_t *tables;           // 合并阶段读取的所有私有表 / Every private table, read by the merge phase
+    size_t num_tables;
+    size_t partition;             // 合并阶段负责的分区 / Partition owned in the merge phase
+    wf_table_t merged;            // 合并结果 / Merged partition
+    bool failed;
+} wf_job_t;
+
+// 分区号取哈希的高32位，与表内位置（低位）无关 / Partition from the high 32 bits, independent of the slot index (low bits)
+static inline size_t partition_of(uint64_t hash, size_t partitions) {
+    return (size_t)(hash >> 32) % partitions;
+}
+
+// 统计阶段 / Count phase
+static void* count_job(void *arg) {
+    wf_job_t *job = arg;
+    if (!table_init(&job->table, WORD_FREQ_INITIAL_CAPACITY)) {
+        job->failed = true;
+        return NULL;
+    }
+    const unsigned char *p = job->begin;
+    const unsigned char *end = job->end;
+    uint64_t words = 0;
+    while (p < end) {
+        while (p < end && STR_IS_SPACE(*p)) {
+            p++;
+        }
+        if (p == end) {
+            break;
+        }
+        const unsigned char *start = p;
+        while (p < end && !STR_IS_SPACE(*p)) {
+            p++;
+        }
+        size_t len = (size_t)(p - start);
+        if (!table_add(&job->table, (const char *)start, len, hash64(start, len, HASH_DEFAULT_SEED), 1)) {
+            job->failed = true;
+            return NULL;
+        }
+        words++;
+    }
+    job->words = words;
+    return NULL;
+}
+
+// 合并阶段 / Merge phase
+static void* merge_job(void *arg) {
+    wf_job_t *job = arg;
+    size_t estimate = 0;
+    for (size_t t = 0; t < job->num_tables; t++) {
+        estimate += job->tables[t].count;
+    }
+    estimate /= job->num_tables;
+    size_t capacity = WORD_FREQ_INITIAL_CAPACITY;
+    while (capacity < estimate * 2) {
+        capacity *= 2;
+    }
+    if (!table_init(&job->merged, capacity)) {
+        job->failed = true;
+        return NULL;
+    }
+    for (size_t t = 0; t < job->num_tables; t++) {
+        const wf_table_t *table = &job->tables[t];
+        for (size_t i = 0; i < table->capacity; i++) {
+            const wf_slot_t *slot = &table->slots[i];
+            if (slot->word != NULL && partition_of(slot->hash, job->num_tables) == job->partition) {
+                if (!table_add(&job->merged, slot->word, slot->len, slot->hash, slot->count)) {
+                    job->failed = true;
+                    return NULL;
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+// =====================================================================
+// 函数实现 / Function Implementations
+// =====================================================================
+
+// CPU核数 / Number of CPU cores
+int word_freq_default_threads(void) {
+    int n = utils_cpu_count();
+    return n > WORD_FREQ_MAX_THREADS ? WORD_FREQ_MAX_THREADS : n;
+}
+
+// 统计内存中文本的词频 / Count word frequencies in text held in memory
+bool word_freq_count(const char *text, size_t len, int threads, word_freq_t *result) {
+    if (result == NULL || (text == NULL && len > 0)) {
+        return false;
+    }
+    memset(result, 0, sizeof(*result));
+
+    size_t n = threads > 0 ? (size_t)threads : (size_t)word_freq_default_threads();
+    if (n > WORD_FREQ_MAX_THREADS) {
+        n = WORD_FREQ_MAX_THREADS;
+    }
+    if (n > len / WORD_FREQ_MIN_RANGE + 1) {
+        n = len / WORD_FREQ_MIN_RANGE + 1;
+    }
+
+    wf_job_t *jobs = calloc(n, sizeof(wf_job_t));
+    wf_table_t *tables = malloc(n * sizeof(wf_table_t));
+    if (jobs == NULL || tables == NULL) {
+        free(jobs);
+        free(tables);
+        return false;
+    }
+
+    // 边界向后移到空白处，单词不会被切开 / Boundaries move forward to whitespace so no word is cut
+    const unsigned char *base = (const unsigned char *)text;
+    size_t begin = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t end = i + 1 == n ? len : len / n * (i + 1);
+        if (end < begin) {
+            end = begin;
+        }
+        while (end < len && !STR_IS_SPACE(base[end])) {
+            end++;
+        }
+        jobs[i].begin = base + begin;
+        jobs[i].end = base + end;
+        begin = end;
+    }
+    utils_run_jobs(jobs, sizeof(wf_job_t), n, count_job);
+
+    bool ok = true;
+    for (size_t i = 0; i < n; i++) {
+        ok = ok && !jobs[i].failed;
+        tables[i] = jobs[i].table;
+        result->total_words += jobs[i].words;
+    }
+
+    if (ok) {
+        for (size_t i = 0; i < n; i++) {
+            jobs[i].tables = tables;
+            jobs[i].num_tables = n;
+            jobs[i].partition = i;
+        }
+        utils_run_jobs(jobs, sizeof(wf_job_t), n, merge_job);
+        size_t distinct = 0;
+        for (size_t i = 0; i < n; i++) {
+            ok = ok && !jobs[i].failed;
+            distinct += jobs[i].merged.count;
+        }
+        result->entries = ok ? malloc((distinct > 0 ? distinct : 1) * sizeof(word_count_t)) : NULL;
+        ok = result->entries != NULL;
+        if (ok) {
+            for (size_t i = 0; i < n; i++) {
+                const wf_table_t *merged = &jobs[i].merged;
+                for (size_t s = 0; s < merged->capacity; s++) {
+                    const wf_slot_t *slot = &merged->slots[s];
+                    if (slot->word != NULL) {
+                        result->entries[result->count++] = (word_count_t){ slot->word, slot->len, slot->count };
+                    }
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        free(jobs[i].table.slots);
+        free(jobs[i].merged.slots);
+    }
+    free(jobs);
+    free(tables);
+    if (!ok) {
+        word_freq_free(result);
+    }
+    return ok;
+}
+
+// 统计文件的词频 / Count word frequencies in a file
+bool word_freq_file(const char *path, int threads, word_freq_t *result) {
+    if (path == NULL || result == NULL) {
+        return false;
+    }
+    void *data = NULL;
+    size_t size = 0;
+
+#if WORD_FREQ_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    size = (size_t)st.st_size;
+    if (size > 0) {
+        data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        // 每个线程顺序读自己的段，提示内核预读 / Each thread reads its range in order; ask for read-ahead
+        posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+    }
+    close(fd);   // 映射在关闭后仍然有效 / The mapping stays valid after close
+#else
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    if (fseek(file, 0, SEEK_END) == 0) {
+        long end = ftell(file);
+        size = end > 0 ? (size_t)end : 0;
+        rewind(file);
+    }
+    if (size > 0) {
+        data = malloc(size);
+        if (data == NULL || fread(data, 1, size, file) != size) {
+            free(data);
+            fclose(file);
+            return false;
+        }
+    }
+    fclose(file);
+#endif
+
+    if (!word_freq_count(data, size, threads, result)) {
+#if WORD_FREQ_MMAP
+        if (data != NULL) {
+            munmap(data, size);
+        }
+#else
+        free(data);
+#endif
+        return false;
+    }
+    result->mapping = data;
+    result->mapping_size = size;
+    return true;
+}
+
+// a是否排在b前面：次数多的在前，次数相同按字节序 / Whether a ranks before b: higher count first, ties in byte order
+static bool ranks_before(const word_count_t *a, const word_count_t *b) {
+    if (a->count != b->count) {
+        return a->count > b->count;
+    }
+    size_t n = a->len < b->len ? a->len : b->len;
+    int c = memcmp(a->word, b->word, n);
+    return c != 0 ? c < 0 : a->len < b->len;
+}
+
+static int compare_rank(const void *a, const void *b) {
+    const word_count_t *x = a, *y = b;
+    if (ranks_before(x, y)) {
+        return -1;
+    }
+    return ranks_before(y, x) ? 1 : 0;
+}
+
+// 最小堆下沉：堆顶是排名最靠后的 / Min-heap sift-down: the root ranks last
+static void heap_sift_down(word_count_t *heap, size_t size, size_t i) {
+    for (;;) {
+        size_t worst = i;
+        size_t left = 2 * i + 1, right = left + 1;
+        if (left < size && ranks_before(&heap[worst], &heap[left])) {
+            worst = left;
+        }
+        if (right < size && ranks_before(&heap[worst], &heap[right])) {
+            worst = right;
+        }
+        if (worst == i) {
+            return;
+        }
+        word_count_t t = heap[i];
+        heap[i] = heap[worst];
+        heap[worst] = t;
+        i = worst;
+    }
+}
+
+// 出现最多的n个单词 / The n most frequent words
+size_t word_freq_top(const word_freq_t *result, size_t n, word_count_t *out) {
+    if (result == NULL || out == NULL || n == 0) {
+        return 0;
+    }
+    size_t size = 0;
+    for (size_t i = 0; i < result->count; i++) {
+        const word_count_t *entry = &result->entries[i];
+        if (size < n) {
+            out[size++] = *entry;
+            if (size == n) {
+                for (size_t k = n / 2; k-- > 0;) {
+                    heap_sift_down(out, n, k);
+                }
+            }
+        } else if (ranks_before(entry, &out[0])) {
+            out[0] = *entry;
+            heap_sift_down(out, n, 0);
+        }
+    }
+    qsort(out, size, sizeof(word_count_t), compare_rank);
+    return size;
+}
+
+// 把全部结果按次数降序排序 / Sort every entry by descending count
+void word_freq_sort(word_freq_t *result) {
+    if (result != NULL && result->entries != NULL) {
+        qsort(result->entries, result->count, sizeof(word_count_t), compare_rank);
+    }
+}
+
+// 释放结果 / Free a result
+void word_freq_free(word_freq_t *result) {
+    if (result == NULL) {
+        return;
+    }
+    free(result->entries);
+    if (result->mapping != NULL) {
+#if WORD_FREQ_MMAP
+        munmap(result->mapping, result->mapping_size);
+#else
+        free(result->mapping);
+#endif
+    }
+    memset(result, 0, sizeof(*result));
+}
@@ -0,0 +1,110 @@
+/**
+ * 词频统计头文件 / Word Frequency Header
+ *
+ * 并行map-reduce：文本按空白边界切成若干段，每个线程统计到自己的开放寻址哈希表，
+ * 再按哈希分区并行合并
+ * Parallel map-reduce: the text is cut into ranges at whitespace boundaries, each thread counts
+ * into its own open-addressing hash table, and the tables are merged in parallel by hash partition
+ */
+
+#ifndef WORD_FREQ_H
+#define WORD_FREQ_H
+
+#include <stdbool.h>  // 用于 bool / For bool
+#include <stddef.h>   // 用于 size_t / For size_t
+#include <stdint.h>   // 用于 uint64_t / For uint64_t
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 最大线程数 / Maximum number of threads
+#define WORD_FREQ_MAX_THREADS 64
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 一个单词及其次数 / One word and its count
+typedef struct {
+    const char *word;       // 指向文本内部，不以'\0'结尾 / Points into the text, not '\0'-terminated
+    size_t len;             // 单词长度 / Word length
+    uint64_t count;         // 出现次数 / Occurrences
+} word_count_t;
+
+// 统计结果 / Counting result
+typedef struct {
+    word_count_t *entries;  // 每个不同单词一项，顺序不定 / One entry per distinct word, in no particular order
+    size_t count;           // 不同单词数 / Number of distinct words
+    uint64_t total_words;   // 单词总数 / Total words
+    void *mapping;          // word_freq_file映射的文件 / File mapped by word_freq_file
+    size_t mapping_size;    // 映射大小 / Mapping size
+} word_freq_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 统计内存中文本的词频 / Count word frequencies in text held in memory
+ *
+ * 单词是空白字符（STR_IS_SPACE：空格、\t、\n、\v、\f、\r）分隔的字节序列；
+ * 结果中的单词指针指向text，text必须比结果活得长
+ * A word is a run of bytes separated by whitespace (STR_IS_SPACE: space, \t, \n, \v, \f, \r);
+ * word pointers in the result point into text, which must outlive the result
+ *
+ * @param text 文本 / Text
+ * @param len 文本长度 / Text length
+ * @param threads 线程数，0表示CPU核数 / Number of threads, 0 for the number of CPU cores
+ * @param result 输出（用word_freq_free释放）/ Output (release with word_freq_free)
+ * @return 成功返回true，内存不足返回false / true on success, false when out of memory
+ */
+bool word_freq_count(const char *text, size_t len, int threads, word_freq_t *result);
+
+/**
+ * 统计文件的词频 / Count word frequencies in a file
+ *
+ * POSIX上用mmap映射文件，页面按需读入、可以被换出，文件可以大于内存；
+ * Windows上读入整个文件
+ * On POSIX the file is mmap-ed, so pages are read on demand and can be evicted and the file may
+ * be larger than RAM; on Windows the whole file is read in
+ *
+ * @param path 文件路径 / File path
+ * @param threads 线程数，0表示CPU核数 / Number of threads, 0 for the number of CPU cores
+ * @param result 输出（映射保留到word_freq_free）/ Output (the mapping lives until word_freq_free)
+ * @return 成功返回true / true on success
+ */
+bool word_freq_file(const char *path, int threads, word_freq_t *result);
+
+/**
+ * 出现最多的n个单词 / The n most frequent words
+ *
+ * 用大小为n的最小堆选择，按次数降序输出，次数相同按字节序
+ * Selected with a min-heap of size n, output by descending count, ties in byte order
+ *
+ * @param result 统计结果 / Counting result
+ * @param n 个数 / Count
+ * @param out 输出数组（至少n项）/ Output array (at least n entries)
+ * @return 实际输出的个数 / Number of entries written
+ */
+size_t word_freq_top(const word_freq_t *result, size_t n, word_count_t *out);
+
+/**
+ * 把全部结果按次数降序排序 / Sort every entry by descending count
+ * @param result 统计结果 / Counting result
+ */
+void word_freq_sort(word_freq_t *result);
+
+/**
+ * CPU核数 / Number of CPU cores
+ * @return 核数（至少为1）/ Number of cores (at least 1)
+ */
+int word_freq_default_threads(void);
+
+/**
+ * 释放结果（以及word_freq_file的映射）/ Free a result (and word_freq_file's mapping)
+ * @param result 统计结果 / Counting result
+ */
+void word_freq_free(word_freq_t *result);
+
+#endif // WORD_FREQ_H
@@ -0,0 +1,164 @@
+/**
+ * 词频统计工具 / Word Frequency Tool
+ *
+ * 用法 / Usage:
+ *   ./wordfreq                       不带参数：在生成的语料上演示线程扩展性
+ *                                    No arguments: show thread scaling on a generated corpus
+ *   ./wordfreq FILE [-n N] [-t T]    输出FILE中出现最多的N个单词（默认20）
+ *                                    Print the N most frequent words in FILE (default 20)
+ *   ./wordfreq FILE -a [-t T]        输出全部单词的次数（按次数降序）
+ *                                    Print every word's count (by descending count)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "word_freq.h"
+#include "bench.h"
+
+// 生成语料的大小和词汇量 / Size and vocabulary of the generated corpus
+#define CORPUS_SIZE (32 * 1024 * 1024)
+#define VOCABULARY 50000
+
+// 打印前n个单词 / Print the top n words
+static void print_top(const word_freq_t *result, size_t n) {
+    word_count_t *top = malloc((n > 0 ? n : 1) * sizeof(word_count_t));
+    if (top == NULL) {
+        return;
+    }
+    size_t count = word_freq_top(result, n, top);
+    for (size_t i = 0; i < count; i++) {
+        printf("  %7llu  %.*s\n", (unsigned long long)top[i].count, (int)top[i].len, top[i].word);
+    }
+    free(top);
+}
+
+// 生成近似Zipf分布的语料：少数单词很常见，多数单词很少见
+// Generate a roughly Zipf-distributed corpus: a few words are common, most are rare
+static char* generate_corpus(size_t size) {
+    char (*words)[12] = malloc(VOCABULARY * sizeof(*words));
+    char *text = malloc(size);
+    if (words == NULL || text == NULL) {
+        free(words);
+        free(text);
+        return NULL;
+    }
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < VOCABULARY; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        size_t len = 2 + state % 9;
+        for (size_t j = 0; j < len; j++) {
+            words[i][j] = (char)('a' + (state >> (5 * j + 8)) % 26);
+        }
+        words[i][len] = '\0';
+    }
+
+    size_t pos = 0;
+    while (pos + 16 < size) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        // u^3把下标集中在前面 / u^3 concentrates indices at the front
+        double u = (double)(state >> 11) / 9007199254740992.0;
+        size_t index = (size_t)(u * u * u * VOCABULARY);
+        size_t len = strlen(words[index]);
+        memcpy(text + pos, words[index], len);
+        pos += len;
+        text[pos++] = (state & 0xF) == 0 ? '\n' : ' ';
+    }
+    memset(text + pos, ' ', size - pos);
+    free(words);
+    return text;
+}
+
+// 不带参数：线程扩展性演示 / No arguments: thread scaling demo
+static int run_demo(void) {
+    char *text = generate_corpus(CORPUS_SIZE);
+    if (text == NULL) {
+        fprintf(stderr, "内存不足 / Out of memory\n");
+        return 1;
+    }
+
+    bench_print_title("词频统计 / Word Frequency");
+    printf("  生成的语料 / Generated corpus: %d MB, %d 个词 / words in the vocabulary\n\n",
+           CORPUS_SIZE / (1024 * 1024), VOCABULARY);
+    printf("  %-8s | %10s | %10s | %8s\n", "threads", "ms", "MB/s", "speedup");
+    printf("  ---------+------------+------------+---------\n");
+
+    int cores = word_freq_default_threads();
+    double t_single = 0;
+    word_freq_t result = { 0 };
+    for (int threads = 1; threads <= cores; threads = bench_next_threads(threads, cores)) {
+        word_freq_free(&result);
+        double start = bench_now();
+        if (!word_freq_count(text, CORPUS_SIZE, threads, &result)) {
+            fprintf(stderr, "统计失败 / Counting failed\n");
+            free(text);
+            return 1;
+        }
+        double elapsed = bench_now() - start;
+        if (threads == 1) {
+            t_single = elapsed;
+        }
+        printf("  %-8d | %10.1f | %10.0f | %7.2fx\n", threads, elapsed * 1e3,
+               CORPUS_SIZE / elapsed / 1e6, elapsed > 0 ? t_single / elapsed : 0.0);
+    }
+
+    printf("\n  单词总数 / Total words: %llu, 不同单词 / Distinct: %zu\n",
+           (unsigned long long)result.total_words, result.count);
+    printf("\n  出现最多的10个 / Top 10:\n");
+    print_top(&result, 10);
+    word_freq_free(&result);
+    free(text);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        return run_demo();
+    }
+
+    const char *path = NULL;
+    size_t top = 20;
+    int threads = 0;
+    bool all = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            top = (size_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-a") == 0) {
+            all = true;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (path == NULL) {
+        fprintf(stderr, "用法 / Usage: %s [FILE [-n N] [-t THREADS] [-a]]\n", argv[0]);
+        return 1;
+    }
+
+    word_freq_t result;
+    double start = bench_now();
+    if (!word_freq_file(path, threads, &result)) {
+        fprintf(stderr, "无法统计 / Cannot count: %s\n", path);
+        return 1;
+    }
+    double elapsed = bench_now() - start;
+
+    if (all) {
+        word_freq_sort(&result);
+        for (size_t i = 0; i < result.count; i++) {
+            printf("%llu\t%.*s\n", (unsigned long long)result.entries[i].count,
+                   (int)result.entries[i].len, result.entries[i].word);
+        }
+    } else {
+        printf("%s: %llu 个单词 / words, %zu 个不同 / distinct, %.1f ms\n", path,
+               (unsigned long long)result.total_words, result.count, elapsed * 1e3);
+        print_top(&result, top);
+    }
+    word_freq_free(&result);
+    return 0;
+}
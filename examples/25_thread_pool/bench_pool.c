@@ -0,0 +1,222 @@
+/**
+ * 线程池扩展性基准测试 / Thread Pool Scaling Benchmark
+ *
+ * 对1、2、4……直到CPU核数两倍的线程数测量：
+ *   均匀负载：每个元素的工作量相同，pool_parallel_for相对串行的加速比
+ *   不均衡负载：前1/16的元素工作量是其他的32倍，对比按线程数静态切块提交和pool_parallel_for的工作窃取
+ *   任务树：每个任务提交两个子任务，测每个任务的调度开销
+ * For 1, 2, 4 ... up to twice the number of CPU cores worker threads, measures:
+ *   uniform load: every element costs the same, speedup of pool_parallel_for over the serial loop
+ *   imbalanced load: the first 1/16 of the elements cost 32 times the rest, comparing one static chunk per
+ *   thread with the work stealing of pool_parallel_for
+ *   task tree: every task submits two children, measuring the scheduling cost per task
+ *
+ * 用法 / Usage:
+ *   ./bench_pool [元素数 / number of elements, default 131072]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+#include "threadpool.h"
+
+// 取最好的一次 / Best of this many runs
+#define REPEAT 3
+
+// 普通元素的xorshift轮数 / xorshift rounds of an ordinary element
+#define ROUNDS 32
+
+// 重元素的倍数 / Cost multiplier of the heavy elements
+#define HEAVY 32
+
+// 并行for的粒度 / Grain of the parallel for
+#define GRAIN 256
+
+// 任务树深度，共2^(DEPTH+1)-1个任务 / Task tree depth, 2^(DEPTH+1)-1 tasks in total
+#define TREE_DEPTH 16
+
+// 获取当前时间 / Get the current time
+static double now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// 负载描述 / Workload description
+typedef struct {
+    size_t heavy_end;       // [0, heavy_end)是重元素 / [0, heavy_end) are heavy elements
+    atomic_ullong checksum;  // 结果异或到这里 / Results are xored into here
+} load_t;
+
+// 一个元素的工作 / Work of one element
+static uint64_t work(size_t i, int rounds) {
+    uint64_t x = (uint64_t)i * 0x9E3779B97F4A7C15ull + 1;
+    for (int r = 0; r < rounds; r++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    return x;
+}
+
+// 处理[begin, end) / Process [begin, end)
+static void run_range(size_t begin, size_t end, void *arg) {
+    load_t *load = arg;
+    uint64_t sum = 0;
+    for (size_t i = begin; i < end; i++) {
+        sum ^= work(i, i < load->heavy_end ? ROUNDS * HEAVY : ROUNDS);
+    }
+    atomic_fetch_xor(&load->checksum, sum);
+}
+
+// 静态切块：一个任务一块 / Static chunking: one task per chunk
+typedef struct {
+    load_t *load;
+    size_t begin, end;
+} chunk_t;
+
+static void run_chunk(void *arg) {
+    chunk_t *chunk = arg;
+    run_range(chunk->begin, chunk->end, chunk->load);
+}
+
+// 任务树 / Task tree
+static pool_t *tree_pool;
+static pool_group_t tree_group;
+
+static void tree_node(void *arg) {
+    uintptr_t depth = (uintptr_t)arg;
+    if (depth > 0) {
+        pool_submit(tree_pool, &tree_group, tree_node, (void *)(depth - 1));
+        pool_submit(tree_pool, &tree_group, tree_node, (void *)(depth - 1));
+    }
+}
+
+// 串行执行，返回秒数 / Run serially, returning seconds
+static double time_serial(load_t *load, size_t count, uint64_t *checksum) {
+    double best = 1e30;
+    for (int r = 0; r < REPEAT; r++) {
+        atomic_store(&load->checksum, 0);
+        double start = now();
+        run_range(0, count, load);
+        double t = now() - start;
+        best = t < best ? t : best;
+    }
+    *checksum = atomic_load(&load->checksum);
+    return best;
+}
+
+// pool_parallel_for执行 / Run with pool_parallel_for
+static double time_parallel_for(pool_t *pool, load_t *load, size_t count, int *ok, uint64_t expected) {
+    double best = 1e30;
+    for (int r = 0; r < REPEAT; r++) {
+        atomic_store(&load->checksum, 0);
+        double start = now();
+        pool_parallel_for(pool, 0, count, GRAIN, run_range, load);
+        double t = now() - start;
+        best = t < best ? t : best;
+        *ok &= atomic_load(&load->checksum) == expected;
+    }
+    return best;
+}
+
+// 每个线程一块静态提交 / Submit one static chunk per thread
+static double time_static(pool_t *pool, load_t *load, size_t count, int *ok, uint64_t expected) {
+    int threads = pool_thread_count(pool);
+    chunk_t *chunks = malloc((size_t)threads * sizeof(chunk_t));
+    if (chunks == NULL) {
+        *ok = 0;
+        return 0.0;
+    }
+    double best = 1e30;
+    for (int r = 0; r < REPEAT; r++) {
+        atomic_store(&load->checksum, 0);
+        pool_group_t group;
+        pool_group_init(&group);
+        double start = now();
+        for (int t = 0; t < threads; t++) {
+            chunks[t].load = load;
+            chunks[t].begin = count * (size_t)t / (size_t)threads;
+            chunks[t].end = count * (size_t)(t + 1) / (size_t)threads;
+            if (!pool_submit(pool, &group, run_chunk, &chunks[t])) {
+                run_chunk(&chunks[t]);
+            }
+        }
+        pool_group_wait(pool, &group);
+        double t = now() - start;
+        best = t < best ? t : best;
+        *ok &= atomic_load(&load->checksum) == expected;
+    }
+    free(chunks);
+    return best;
+}
+
+// 任务树，返回每个任务的纳秒数 / Task tree, returning nanoseconds per task
+static double time_tree(pool_t *pool) {
+    double tasks = (double)((2ull << TREE_DEPTH) - 1);
+    double best = 1e30;
+    tree_pool = pool;
+    for (int r = 0; r < REPEAT; r++) {
+        pool_group_init(&tree_group);
+        double start = now();
+        pool_submit(pool, &tree_group, tree_node, (void *)(uintptr_t)TREE_DEPTH);
+        pool_group_wait(pool, &tree_group);
+        double t = now() - start;
+        best = t < best ? t : best;
+    }
+    return best * 1e9 / tasks;
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 131072;
+    if (argc > 1) {
+        count = (size_t)strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            count = 131072;
+        }
+    }
+    pool_t *probe = pool_create(0);
+    if (probe == NULL) {
+        fprintf(stderr, "创建线程池失败 / Failed to create the pool\n");
+        return 1;
+    }
+    int cores = pool_thread_count(probe);
+    pool_destroy(probe);
+
+    load_t uniform = { 0, 0 };
+    load_t imbalanced = { count / 16, 0 };
+    uint64_t uniform_sum, imbalanced_sum;
+    double uniform_serial = time_serial(&uniform, count, &uniform_sum);
+    double imbalanced_serial = time_serial(&imbalanced, count, &imbalanced_sum);
+
+    printf("\n");
+    printf("========================================\n");
+    printf("  工作窃取线程池 / Work-Stealing Thread Pool\n");
+    printf("========================================\n");
+    printf("  %zu 个元素，%d 个CPU核 / elements, %d CPU cores\n", count, cores, cores);
+    printf("  串行 / serial: uniform %.2f ms, imbalanced %.2f ms\n\n", uniform_serial * 1e3, imbalanced_serial * 1e3);
+    printf("  %7s | %12s | %7s | %14s | %14s | %7s | %10s | %s\n", "threads", "uniform ms", "speedup",
+           "static imb ms", "stealing ms", "speedup", "tree ns/op", "check");
+    printf("  --------+--------------+---------+----------------+----------------+---------+------------+------\n");
+
+    int limit = cores * 2 < POOL_MAX_THREADS ? cores * 2 : POOL_MAX_THREADS;
+    for (int threads = 1; threads <= limit; threads *= 2) {
+        pool_t *pool = pool_create(threads);
+        if (pool == NULL) {
+            fprintf(stderr, "创建线程池失败 / Failed to create the pool\n");
+            return 1;
+        }
+        int ok = 1;
+        double t_uniform = time_parallel_for(pool, &uniform, count, &ok, uniform_sum);
+        double t_static = time_static(pool, &imbalanced, count, &ok, imbalanced_sum);
+        double t_steal = time_parallel_for(pool, &imbalanced, count, &ok, imbalanced_sum);
+        double t_tree = time_tree(pool);
+        pool_destroy(pool);
+        printf("  %7d | %12.2f | %6.2fx | %14.2f | %14.2f | %6.2fx | %10.1f | %s\n", threads, t_uniform * 1e3,
+               uniform_serial / t_uniform, t_static * 1e3, t_steal * 1e3, t_static / t_steal, t_tree,
+               ok ? "ok" : "FAIL");
+    }
+    return 0;
+}
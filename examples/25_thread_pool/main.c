@@ -0,0 +1,138 @@
+#include <stdio.h>
+#include <stdatomic.h>
+#include "threadpool.h"
+
+/**
+ * 线程池使用示例 / Thread Pool Usage Example
+ *
+ * 本程序演示如何使用静态库libthreadpool.a：提交任务、任务组、并行for、任务中嵌套等待和关闭线程池
+ * This program demonstrates the static library libthreadpool.a: submitting tasks, task groups,
+ * parallel for, nested waits inside tasks and shutting the pool down
+ */
+
+// 2. 提交任务 / Submitting tasks
+typedef struct {
+    int input;
+    int output;
+} square_job_t;
+
+static void square(void *arg) {
+    square_job_t *job = arg;
+    job->output = job->input * job->input;
+}
+
+// 3. 并行for：每块求平方和再加到总数上 / Parallel for: each piece sums squares and adds to the total
+static void sum_squares(size_t begin, size_t end, void *arg) {
+    atomic_llong *total = arg;
+    long long sum = 0;
+    for (size_t i = begin; i < end; i++) {
+        sum += (long long)i * (long long)i;
+    }
+    atomic_fetch_add(total, sum);
+}
+
+// 4. 任务中提交子任务并等待：递归求斐波那契数 / Subtasks waited for inside a task: recursive Fibonacci
+typedef struct {
+    pool_t *pool;
+    int n;
+    long long result;
+} fib_job_t;
+
+static long long fib_serial(int n) {
+    return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+static void fib_task(void *arg) {
+    fib_job_t *job = arg;
+    if (job->n < 12) {
+        job->result = fib_serial(job->n);
+        return;
+    }
+    fib_job_t left = { job->pool, job->n - 1, 0 };
+    fib_job_t right = { job->pool, job->n - 2, 0 };
+    pool_group_t group;
+    pool_group_init(&group);
+    if (!pool_submit(job->pool, &group, fib_task, &left)) {
+        fib_task(&left);  // 内存不足时自己做 / Do it here when out of memory
+    }
+    fib_task(&right);
+    pool_group_wait(job->pool, &group);
+    job->result = left.result + right.result;
+}
+
+// 5. 关闭时未等待的任务也会做完 / Tasks nobody waits for still run at shutdown
+static void count_up(void *arg) {
+    atomic_fetch_add((atomic_int *)arg, 1);
+}
+
+int main() {
+    printf("=== C语言线程池示例 / C Thread Pool Example ===\n\n");
+
+    // 1. 创建线程池 / Creating a pool
+    printf("1. 创建线程池 / Creating a Pool:\n");
+    pool_t *pool = pool_create(4);
+    if (pool == NULL) {
+        printf("  创建失败 / Creation failed\n");
+        return 1;
+    }
+    printf("  工作线程数 / Worker threads: %d\n", pool_thread_count(pool));
+    printf("\n");
+
+    // 2. 提交任务和任务组 / Submitting tasks and groups
+    printf("2. 提交任务和任务组 / Submitting Tasks and Groups:\n");
+    square_job_t jobs[8];
+    pool_group_t group;
+    pool_group_init(&group);
+    for (int i = 0; i < 8; i++) {
+        jobs[i].input = i + 1;
+        jobs[i].output = 0;
+        if (!pool_submit(pool, &group, square, &jobs[i])) {
+            square(&jobs[i]);  // 内存不足时自己做 / Do it here when out of memory
+        }
+    }
+    pool_group_wait(pool, &group);
+    printf("  平方 / Squares:");
+    for (int i = 0; i < 8; i++) {
+        printf(" %d", jobs[i].output);
+    }
+    printf("\n\n");
+
+    // 3. 并行for / Parallel for
+    printf("3. 并行for / Parallel For:\n");
+    atomic_llong total;
+    atomic_init(&total, 0);
+    pool_parallel_for(pool, 0, 1000000, 10000, sum_squares, &total);
+    long long expected = 0;
+    for (long long i = 0; i < 1000000; i++) {
+        expected += i * i;
+    }
+    printf("  0到999999的平方和 / Sum of squares 0..999999: %lld\n", (long long)atomic_load(&total));
+    printf("  串行结果 / Serial result:                 %lld (%s)\n", expected,
+           atomic_load(&total) == expected ? "一致 / match" : "不一致 / mismatch");
+    printf("\n");
+
+    // 4. 任务中嵌套等待 / Nested waits inside tasks
+    printf("4. 任务中嵌套等待 / Nested Waits Inside Tasks:\n");
+    fib_job_t fib = { pool, 30, 0 };
+    pool_group_init(&group);
+    if (!pool_submit(pool, &group, fib_task, &fib)) {
+        fib_task(&fib);
+    }
+    pool_group_wait(pool, &group);
+    printf("  fib(30) = %lld (串行 / serial %lld)\n", fib.result, fib_serial(30));
+    printf("\n");
+
+    // 5. 关闭线程池 / Shutting the pool down
+    printf("5. 关闭线程池 / Shutting the Pool Down:\n");
+    atomic_int counter;
+    atomic_init(&counter, 0);
+    int submitted = 0;
+    for (int i = 0; i < 1000; i++) {
+        submitted += pool_submit(pool, NULL, count_up, &counter);
+    }
+    pool_destroy(pool);  // 先做完已提交的任务 / Runs every submitted task first
+    printf("  提交 / Submitted: %d, 完成 / Completed: %d\n", submitted, atomic_load(&counter));
+
+    printf("\n=== 程序结束 / Program End ===\n");
+    return 0;
+}
@@ -0,0 +1,522 @@
+/**
+ * 工作窃取线程池实现文件 / Work-Stealing Thread Pool Implementation
+ *
+ * 每个工作线程先从自己队列的底部取任务，再看全局队列（池外提交的任务），最后从随机的其他线程窃取。
+ * 都没有任务时睡在条件变量上；压入任务的线程看到有人在睡才去加锁唤醒，平时不碰锁
+ * Every worker first takes from the bottom of its own deque, then looks at the global queue (tasks
+ * submitted from outside the pool), and finally steals from random other workers. With no work anywhere
+ * it sleeps on a condition variable; a thread pushing work only takes the lock to wake someone when it
+ * sees a sleeper, so the lock stays out of the common path
+ */
+
+// sysconf和sched_yield需要POSIX声明 / sysconf and sched_yield need the POSIX declarations
+#define _POSIX_C_SOURCE 200809L
+
+#include "threadpool.h"
+#include <pthread.h>    // 用于 pthread_create, pthread_mutex_t / For pthread_create, pthread_mutex_t
+#include <sched.h>      // 用于 sched_yield / For sched_yield
+#include <stdint.h>     // 用于 uint64_t / For uint64_t
+#include <stdlib.h>     // 用于 malloc, free / For malloc, free
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>    // 用于 GetSystemInfo / For GetSystemInfo
+#else
+    #include <unistd.h>     // 用于 sysconf / For sysconf
+#endif
+
+// 缓存行大小，用来隔开不同线程频繁写的变量 / Cache line size, used to keep variables written by different threads apart
+#define CACHE_LINE 64
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+typedef struct worker worker_t;
+typedef struct task task_t;
+
+// 任务头：具体的任务把它放在第一个成员 / Task header: concrete tasks keep it as their first member
+struct task {
+    void (*run)(worker_t *worker, task_t *task);  // 执行并处理收尾 / Runs the task and its bookkeeping
+    pool_group_t *group;                          // 所属任务组，可以为NULL / Owning group, may be NULL
+    task_t *next;                                 // 全局队列中的下一个 / Next task in the global queue
+};
+
+// pool_submit提交的任务，在堆上分配 / Task from pool_submit, allocated on the heap
+typedef struct {
+    task_t task;
+    pool_task_fn fn;
+    void *arg;
+} submitted_t;
+
+// pool_parallel_for的参数，所有分块共用 / Arguments of pool_parallel_for, shared by every piece
+typedef struct {
+    size_t grain;
+    pool_range_fn fn;
+    void *arg;
+} range_t;
+
+// pool_parallel_for分出的右半区间，在分出它的线程的栈上 / Right half split off by pool_parallel_for, on the splitter's stack
+typedef struct {
+    task_t task;
+    const range_t *range;
+    size_t begin, end;
+    atomic_bool done;  // 被窃取后由窃取者置位 / Set by the thief once a stolen piece is finished
+} split_t;
+
+// Chase-Lev双端队列：所有者在bottom端压入和弹出，窃取者在top端取
+// Chase-Lev deque: the owner pushes and pops at bottom, thieves take at top
+typedef struct {
+    atomic_llong top;
+    char pad_top[CACHE_LINE - sizeof(atomic_llong)];
+    atomic_llong bottom;
+    char pad_bottom[CACHE_LINE - sizeof(atomic_llong)];
+    _Atomic(task_t *) buffer[POOL_DEQUE_CAPACITY];
+} deque_t;
+
+// 工作线程 / Worker thread
+struct worker {
+    deque_t deque;
+    pool_t *pool;
+    pthread_t thread;
+    uint64_t rng;      // 选窃取对象的随机数状态 / Random state for picking victims
+    int index;
+    char pad[CACHE_LINE];
+};
+
+// 线程池 / Thread pool
+struct pool {
+    worker_t *workers;
+    int count;
+    pthread_mutex_t lock;       // 保护全局队列和shutdown / Guards the global queue and shutdown
+    pthread_cond_t wake_cond;   // 空闲的工作线程在此睡眠 / Idle workers sleep here
+    pthread_cond_t idle_cond;   // 池外线程在此等待任务组 / Threads outside the pool wait for groups here
+    task_t *head, *tail;        // 全局队列 / Global queue
+    atomic_size_t queued;       // 全局队列长度，不加锁也能看 / Global queue length, readable without the lock
+    atomic_uint epoch;          // 每次唤醒加1（加锁修改）/ Bumped on every wake-up (under the lock)
+    atomic_int sleepers;        // 准备睡眠或正在睡眠的工作线程数 / Workers about to sleep or asleep
+    bool shutdown;
+};
+
+// 当前线程对应的工作线程，池外线程为NULL / Worker of the current thread, NULL outside any pool
+static _Thread_local worker_t *current_worker;
+
+// =====================================================================
+// Chase-Lev双端队列 / Chase-Lev Deque
+// =====================================================================
+// 内存序按Lê等人的C11版本 / Memory orders follow the C11 version by Lê et al.
+
+// 所有者压入，满了返回false / Owner push, false when full
+static bool deque_push(deque_t *deque, task_t *task) {
+    long long b = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    long long t = atomic_load_explicit(&deque->top, memory_order_acquire);
+    if (b - t >= POOL_DEQUE_CAPACITY) {
+        return false;
+    }
+    atomic_store_explicit(&deque->buffer[b & (POOL_DEQUE_CAPACITY - 1)], task, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, b + 1, memory_order_release);
+    return true;
+}
+
+// 所有者弹出最新的任务 / Owner pops the newest task
+static task_t *deque_take(deque_t *deque) {
+    long long b = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long t = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    task_t *task = NULL;
+    if (t <= b) {
+        task = atomic_load_explicit(&deque->buffer[b & (POOL_DEQUE_CAPACITY - 1)], memory_order_relaxed);
+        if (t == b) {
+            // 只剩最后一个，和窃取者抢 / Only one left, race the thieves for it
+            if (!atomic_compare_exchange_strong_explicit(&deque->top, &t, t + 1, memory_order_seq_cst,
+                                                         memory_order_relaxed)) {
+                task = NULL;
+            }
+            atomic_store_explicit(&deque->bottom, b + 1, memory_order_relaxed);
+        }
+    } else {
+        atomic_store_explicit(&deque->bottom, b + 1, memory_order_relaxed);
+    }
+    return task;
+}
+
+// 窃取最早的任务，队列为空或没抢到返回NULL / Steal the oldest task, NULL when empty or when the race is lost
+static task_t *deque_steal(deque_t *deque) {
+    long long t = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long b = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (t >= b) {
+        return NULL;
+    }
+    task_t *task = atomic_load_explicit(&deque->buffer[t & (POOL_DEQUE_CAPACITY - 1)], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &t, t + 1, memory_order_seq_cst,
+                                                 memory_order_relaxed)) {
+        return NULL;
+    }
+    return task;
+}
+
+// =====================================================================
+// 调度 / Scheduling
+// =====================================================================
+
+// 有线程在睡眠时唤醒一个；调用前任务必须已经放好
+// Wake one worker if any is asleep; the task must already be in place
+static void notify(pool_t *pool) {
+    // 与睡眠方的sleepers加1配对：要么我们看到它，要么它复查时看到任务
+    // Pairs with the sleeper's increment: either we see it, or its recheck sees the task
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&pool->sleepers, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&pool->lock);
+        atomic_fetch_add_explicit(&pool->epoch, 1, memory_order_relaxed);
+        pthread_cond_signal(&pool->wake_cond);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+// 放入全局队列 / Append to the global queue
+static void enqueue_global(pool_t *pool, task_t *task) {
+    task->next = NULL;
+    pthread_mutex_lock(&pool->lock);
+    if (pool->tail != NULL) {
+        pool->tail->next = task;
+    } else {
+        pool->head = task;
+    }
+    pool->tail = task;
+    atomic_fetch_add(&pool->queued, 1);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// 从全局队列取一个 / Take one task from the global queue
+static task_t *dequeue_global(pool_t *pool) {
+    if (atomic_load(&pool->queued) == 0) {
+        return NULL;
+    }
+    pthread_mutex_lock(&pool->lock);
+    task_t *task = pool->head;
+    if (task != NULL) {
+        pool->head = task->next;
+        if (pool->head == NULL) {
+            pool->tail = NULL;
+        }
+        atomic_fetch_sub(&pool->queued, 1);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return task;
+}
+
+// 依次看自己的队列、全局队列和其他线程的队列 / Look at the own deque, the global queue and other deques in turn
+static task_t *find_work(worker_t *worker) {
+    task_t *task = deque_take(&worker->deque);
+    if (task != NULL) {
+        return task;
+    }
+    pool_t *pool = worker->pool;
+    task = dequeue_global(pool);
+    if (task != NULL) {
+        return task;
+    }
+    // xorshift选起点，依次试一遍其他线程 / Pick a start with xorshift and try every other worker once
+    uint64_t x = worker->rng;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    worker->rng = x;
+    int count = pool->count;
+    int start = (int)(x % (uint64_t)count);
+    for (int i = 0; i < count; i++) {
+        int victim = start + i < count ? start + i : start + i - count;
+        if (victim == worker->index) {
+            continue;
+        }
+        task = deque_steal(&pool->workers[victim].deque);
+        if (task != NULL) {
+            return task;
+        }
+    }
+    return NULL;
+}
+
+// 任务组的一个任务完成；最后一个唤醒池外的等待者
+// One task of a group finished; the last one wakes waiters outside the pool
+static void group_done(pool_t *pool, pool_group_t *group) {
+    if (group != NULL && atomic_fetch_sub_explicit(&group->pending, 1, memory_order_acq_rel) == 1) {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_broadcast(&pool->idle_cond);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+// 执行pool_submit提交的任务 / Run a task from pool_submit
+static void run_submitted(worker_t *worker, task_t *task) {
+    submitted_t *submitted = (submitted_t *)task;
+    pool_task_fn fn = submitted->fn;
+    void *arg = submitted->arg;
+    pool_group_t *group = task->group;
+    free(submitted);
+    fn(arg);
+    group_done(worker->pool, group);
+}
+
+// 执行本线程上的任务直到done置位，期间帮忙做别的任务
+// Keep running other tasks on this thread until done is set
+static void help_until(worker_t *worker, const atomic_bool *done) {
+    while (!atomic_load_explicit(done, memory_order_acquire)) {
+        task_t *task = find_work(worker);
+        if (task != NULL) {
+            task->run(worker, task);
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+static void run_split(worker_t *worker, task_t *task);
+
+// 对半分[begin, end)直到不超过grain / Halve [begin, end) until at most grain elements remain
+static void split_range(worker_t *worker, const range_t *range, size_t begin, size_t end) {
+    while (end - begin > range->grain) {
+        size_t mid = begin + (end - begin) / 2;
+        split_t right = { { run_split, NULL, NULL }, range, mid, end, false };
+        if (!deque_push(&worker->deque, &right.task)) {
+            break;  // 队列满了就自己按grain逐块做 / Deque full, do the rest chunk by chunk here
+        }
+        notify(worker->pool);
+        split_range(worker, range, begin, mid);
+
+        // 弹出右半之上的任务（fn里提交的）；弹到右半说明没被窃取，自己做
+        // Pop the tasks above the right half (submitted inside fn); reaching the right half means nobody
+        // stole it, so run it here
+        task_t *task;
+        while ((task = deque_take(&worker->deque)) != NULL) {
+            if (task == &right.task) {
+                split_range(worker, range, mid, end);
+                return;
+            }
+            task->run(worker, task);
+        }
+        // 右半被窃取了，等窃取者做完 / The right half was stolen, wait for the thief
+        help_until(worker, &right.done);
+        return;
+    }
+    for (; begin < end; begin += range->grain) {
+        size_t stop = end - begin > range->grain ? begin + range->grain : end;
+        range->fn(begin, stop, range->arg);
+    }
+}
+
+// 执行被窃取的右半或池外提交的整个区间 / Run a stolen right half or a whole range submitted from outside
+static void run_split(worker_t *worker, task_t *task) {
+    split_t *split = (split_t *)task;
+    pool_group_t *group = task->group;
+    split_range(worker, split->range, split->begin, split->end);
+    // 之后split所在的栈可能已经没了，不能再访问它 / The stack holding split may be gone afterwards, so it is not touched again
+    if (group != NULL) {
+        group_done(worker->pool, group);
+    } else {
+        atomic_store_explicit(&split->done, true, memory_order_release);
+    }
+}
+
+// 工作线程主循环 / Worker main loop
+static void *worker_main(void *data) {
+    worker_t *worker = data;
+    pool_t *pool = worker->pool;
+    current_worker = worker;
+    for (;;) {
+        task_t *task = find_work(worker);
+        if (task == NULL) {
+            // 先登记再复查，复查后才睡；notify在登记之后一定会加锁唤醒
+            // Register first, recheck, and only then sleep; any notify after the registration locks and wakes
+            unsigned epoch = atomic_load(&pool->epoch);
+            atomic_fetch_add(&pool->sleepers, 1);
+            task = find_work(worker);
+            if (task == NULL) {
+                pthread_mutex_lock(&pool->lock);
+                while (atomic_load(&pool->epoch) == epoch && !pool->shutdown) {
+                    pthread_cond_wait(&pool->wake_cond, &pool->lock);
+                }
+                bool stop = pool->shutdown;
+                pthread_mutex_unlock(&pool->lock);
+                atomic_fetch_sub(&pool->sleepers, 1);
+                // 关闭时还要把剩下的任务做完 / During shutdown the remaining tasks are still run
+                if (stop && (task = find_work(worker)) == NULL) {
+                    break;
+                }
+                if (task == NULL) {
+                    continue;
+                }
+            } else {
+                atomic_fetch_sub(&pool->sleepers, 1);
+            }
+        }
+        task->run(worker, task);
+    }
+    current_worker = NULL;
+    return NULL;
+}
+
+// CPU核数 / Number of CPU cores
+static int cpu_count(void) {
+    long n = 1;
+#if defined(_WIN32) || defined(_WIN64)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    n = (long)info.dwNumberOfProcessors;
+#else
+    n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (n < 1) {
+        n = 1;
+    }
+    return n > POOL_MAX_THREADS ? POOL_MAX_THREADS : (int)n;
+}
+
+// 结束已启动的工作线程 / Stop the workers started so far
+static void stop_workers(pool_t *pool, int started) {
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->wake_cond);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < started; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+}
+
+// =====================================================================
+// 函数实现 / Function Implementations
+// =====================================================================
+
+pool_t *pool_create(int threads) {
+    if (threads < 0) {
+        return NULL;
+    }
+    if (threads == 0) {
+        threads = cpu_count();
+    }
+    if (threads > POOL_MAX_THREADS) {
+        threads = POOL_MAX_THREADS;
+    }
+    pool_t *pool = calloc(1, sizeof(pool_t));
+    if (pool == NULL) {
+        return NULL;
+    }
+    pool->workers = calloc((size_t)threads, sizeof(worker_t));
+    if (pool->workers == NULL) {
+        free(pool);
+        return NULL;
+    }
+    pool->count = threads;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake_cond, NULL);
+    pthread_cond_init(&pool->idle_cond, NULL);
+    atomic_init(&pool->queued, 0);
+    atomic_init(&pool->epoch, 0);
+    atomic_init(&pool->sleepers, 0);
+    for (int i = 0; i < threads; i++) {
+        worker_t *worker = &pool->workers[i];
+        atomic_init(&worker->deque.top, 0);
+        atomic_init(&worker->deque.bottom, 0);
+        worker->pool = pool;
+        worker->index = i;
+        worker->rng = 0x9E3779B97F4A7C15ull * (uint64_t)(i + 1);
+    }
+    // 所有队列都初始化好之后才启动线程，窃取时会读别人的队列
+    // Threads start only after every deque is ready, since stealing reads the others
+    for (int i = 0; i < threads; i++) {
+        if (pthread_create(&pool->workers[i].thread, NULL, worker_main, &pool->workers[i]) != 0) {
+            stop_workers(pool, i);
+            pthread_cond_destroy(&pool->idle_cond);
+            pthread_cond_destroy(&pool->wake_cond);
+            pthread_mutex_destroy(&pool->lock);
+            free(pool->workers);
+            free(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+void pool_destroy(pool_t *pool) {
+    if (pool == NULL) {
+        return;
+    }
+    stop_workers(pool, pool->count);
+    pthread_cond_destroy(&pool->idle_cond);
+    pthread_cond_destroy(&pool->wake_cond);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+}
+
+int pool_thread_count(const pool_t *pool) {
+    return pool->count;
+}
+
+void pool_group_init(pool_group_t *group) {
+    atomic_init(&group->pending, 0);
+}
+
+bool pool_submit(pool_t *pool, pool_group_t *group, pool_task_fn fn, void *arg) {
+    submitted_t *submitted = malloc(sizeof(submitted_t));
+    if (submitted == NULL) {
+        return false;
+    }
+    submitted->task.run = run_submitted;
+    submitted->task.group = group;
+    submitted->fn = fn;
+    submitted->arg = arg;
+    if (group != NULL) {
+        atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+    }
+    worker_t *worker = current_worker;
+    if (worker == NULL || worker->pool != pool || !deque_push(&worker->deque, &submitted->task)) {
+        enqueue_global(pool, &submitted->task);
+    }
+    notify(pool);
+    return true;
+}
+
+void pool_group_wait(pool_t *pool, pool_group_t *group) {
+    worker_t *worker = current_worker;
+    if (worker != NULL && worker->pool == pool) {
+        // 工作线程边等边做任务，子任务等父任务不会死锁
+        // A worker runs tasks while waiting, so tasks waiting for their subtasks cannot deadlock
+        while (atomic_load_explicit(&group->pending, memory_order_acquire) > 0) {
+            task_t *task = find_work(worker);
+            if (task != NULL) {
+                task->run(worker, task);
+            } else {
+                sched_yield();
+            }
+        }
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    while (atomic_load_explicit(&group->pending, memory_order_acquire) > 0) {
+        pthread_cond_wait(&pool->idle_cond, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void pool_parallel_for(pool_t *pool, size_t begin, size_t end, size_t grain, pool_range_fn fn, void *arg) {
+    if (begin >= end) {
+        return;
+    }
+    range_t range = { grain > 0 ? grain : 1, fn, arg };
+    worker_t *worker = current_worker;
+    if (worker != NULL && worker->pool == pool) {
+        split_range(worker, &range, begin, end);
+        return;
+    }
+    // 池外调用：整个区间作为一个任务放入全局队列，再等它完成
+    // Called from outside: the whole range goes to the global queue as one task, then we wait for it
+    pool_group_t group;
+    pool_group_init(&group);
+    atomic_store(&group.pending, 1);
+    split_t root = { { run_split, &group, NULL }, &range, begin, end, false };
+    enqueue_global(pool, &root.task);
+    notify(pool);
+    pool_group_wait(pool, &group);
+}
@@ -0,0 +1,128 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+/**
+ * 工作窃取线程池头文件 / Work-Stealing Thread Pool Header
+ *
+ * 这是静态库libthreadpool.a的头文件。每个工作线程有自己的Chase-Lev双端队列：
+ * 自己在底部压入和弹出（后进先出，缓存热），空闲的线程从随机选中的其他线程的顶部窃取（先进先出，拿走较大的块）
+ * This is the header of the static library libthreadpool.a. Every worker thread owns a Chase-Lev deque:
+ * it pushes and pops at the bottom itself (last in first out, cache-hot) while idle threads steal from the
+ * top of a randomly chosen other worker (first in first out, taking the larger pieces)
+ *
+ * 参考 / References:
+ *   Chase & Lev, "Dynamic Circular Work-Stealing Deque", SPAA 2005.
+ *   Lê, Pop, Cohen & Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013.
+ */
+
+#include <stdatomic.h>  // 用于 atomic_size_t / For atomic_size_t
+#include <stdbool.h>    // 用于 bool / For bool
+#include <stddef.h>     // 用于 size_t / For size_t
+
+// =====================================================================
+// 宏定义 / Macro Definitions
+// =====================================================================
+
+// 最多的工作线程数 / Maximum number of worker threads
+#define POOL_MAX_THREADS 256
+
+// 每个工作线程的双端队列容量（2的幂）；满了的任务改放到全局队列
+// Capacity of every worker's deque (a power of two); tasks that do not fit go to the global queue
+#define POOL_DEQUE_CAPACITY 1024
+
+// =====================================================================
+// 类型定义 / Type Definitions
+// =====================================================================
+
+// 线程池（不透明类型）/ Thread pool (opaque type)
+typedef struct pool pool_t;
+
+// 任务函数 / Task function
+typedef void (*pool_task_fn)(void *arg);
+
+// 区间函数：处理[begin, end) / Range function: processes [begin, end)
+typedef void (*pool_range_fn)(size_t begin, size_t end, void *arg);
+
+// 任务组：记录还没完成的任务数，由调用者分配（可以在栈上）
+// Task group: counts the tasks not finished yet, allocated by the caller (possibly on the stack)
+typedef struct {
+    atomic_size_t pending;  // 未完成的任务数 / Number of unfinished tasks
+} pool_group_t;
+
+// =====================================================================
+// 函数声明 / Function Declarations
+// =====================================================================
+
+/**
+ * 创建线程池 / Create a thread pool
+ * @param threads 工作线程数，0表示CPU核数 / Number of worker threads, 0 for the number of CPU cores
+ * @return 线程池，失败返回NULL / Thread pool, NULL on failure
+ */
+pool_t *pool_create(int threads);
+
+/**
+ * 关闭线程池：先执行完所有已提交的任务，再结束工作线程并释放内存；不能在任务中调用
+ * Shut the pool down: every submitted task runs first, then the workers exit and the memory is freed;
+ * must not be called from a task
+ *
+ * @param pool 线程池，可以为NULL / Thread pool, may be NULL
+ */
+void pool_destroy(pool_t *pool);
+
+/**
+ * 工作线程数 / Number of worker threads
+ * @param pool 线程池 / Thread pool
+ * @return 工作线程数 / Number of worker threads
+ */
+int pool_thread_count(const pool_t *pool);
+
+/**
+ * 初始化任务组 / Initialize a task group
+ * @param group 任务组 / Task group
+ */
+void pool_group_init(pool_group_t *group);
+
+/**
+ * 提交一个任务 / Submit a task
+ *
+ * 在工作线程中提交时压入它自己的队列，否则放入全局队列
+ * Pushed onto the worker's own deque when submitted from a worker thread, otherwise onto the global queue
+ *
+ * @param pool 线程池 / Thread pool
+ * @param group 任务组，NULL表示不需要等待它 / Task group, NULL when nobody waits for the task
+ * @param fn 任务函数 / Task function
+ * @param arg 传给fn的参数 / Argument passed to fn
+ * @return 内存不足时返回false，任务没有提交 / false when out of memory, and the task was not submitted
+ */
+bool pool_submit(pool_t *pool, pool_group_t *group, pool_task_fn fn, void *arg);
+
+/**
+ * 等待任务组中的任务全部完成 / Wait until every task of a group has finished
+ *
+ * 工作线程等待时会继续执行其他任务，所以任务中可以提交子任务并等待它们
+ * A worker thread keeps running other tasks while it waits, so tasks may submit subtasks and wait for them
+ *
+ * @param pool 线程池 / Thread pool
+ * @param group 任务组 / Task group
+ */
+void pool_group_wait(pool_t *pool, pool_group_t *group);
+
+/**
+ * 并行处理区间[begin, end)，返回时全部完成 / Process the range [begin, end) in parallel, all done on return
+ *
+ * 区间不断对半分，右半压入队列等别的线程窃取，左半继续分，直到不超过grain个元素时调用fn；
+ * 没被窃取的右半由自己接着执行。可以在任务中嵌套调用
+ * The range is halved repeatedly, pushing the right half for other threads to steal and splitting the left
+ * half further until at most grain elements remain, which are passed to fn; right halves nobody stole are
+ * run by the same thread afterwards. May be nested inside tasks
+ *
+ * @param pool 线程池 / Thread pool
+ * @param begin 起点 / Start
+ * @param end 终点（不含）/ End (exclusive)
+ * @param grain 每次调用fn最多处理的元素数，0按1算 / Most elements per call of fn, 0 counts as 1
+ * @param fn 区间函数 / Range function
+ * @param arg 传给fn的参数 / Argument passed to fn
+ */
+void pool_parallel_for(pool_t *pool, size_t begin, size_t end, size_t grain, pool_range_fn fn, void *arg);
+
+#endif // THREADPOOL_H